@@ -4,7 +4,7 @@ import numpy
 import os
 import typing
 import uuid
-__all__ = ['ActionForm', 'Actor', 'ActorDamageEvent', 'ActorDeathEvent', 'ActorEvent', 'ActorExplodeEvent', 'ActorKnockbackEvent', 'ActorRemoveEvent', 'ActorSpawnEvent', 'ActorTeleportEvent', 'BanEntry', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockData', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BlockState', 'BossBar', 'BroadcastMessageEvent', 'Cancellable', 'Chunk', 'ChunkEvent', 'ChunkLoadEvent', 'ChunkUnloadEvent', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'CommandSenderWrapper', 'ConsoleCommandSender', 'Criteria', 'DamageSource', 'Dimension', 'DimensionEvent', 'DisplaySlot', 'Divider', 'Dropdown', 'Enchantment', 'EnchantmentRegistry', 'EquipmentSlot', 'Event', 'EventPriority', 'GameMode', 'Header', 'Inventory', 'IpBanEntry', 'IpBanList', 'ItemFactory', 'ItemMeta', 'ItemRegistry', 'ItemStack', 'ItemType', 'Label', 'Language', 'LeavesDecayEvent', 'Level', 'LevelEvent', 'Location', 'Logger', 'MapCanvas', 'MapMeta', 'MapRenderer', 'MapView', 'MessageForm', 'Mob', 'MobEvent', 'ModalForm', 'NamespacedKey', 'Objective', 'ObjectiveSortOrder', 'OfflinePlayer', 'PacketReceiveEvent', 'PacketSendEvent', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'PermissionLevel', 'Player', 'PlayerBanEntry', 'PlayerBanList', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDeathEvent', 'PlayerDropItemEvent', 'PlayerEmoteEvent', 'PlayerEvent', 'PlayerGameModeChangeEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerItemConsumeEvent', 'PlayerJoinEvent', 'PlayerJumpEvent', 'PlayerKickEvent', 'PlayerLoginEvent', 'PlayerMoveEvent', 'PlayerPickupItemEvent', 'PlayerQuitEvent', 'PlayerRespawnEvent', 'PlayerTeleportEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'ScriptMessageEvent', 'Server', 'ServerCommandEvent', 'ServerEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'Service', 'ServiceManager', 'ServicePriority', 'Skin', 'Slider', 'SocketAddress', 'StepSlider', 'Task', 'TextInput', 'ThunderChangeEvent', 'Toggle', 'Translatable', 'Vector', 'WeatherChangeEvent', 'WeatherEvent']
+__all__ = ['ActionForm', 'Actor', 'ActorColumns', 'ActorDamageEvent', 'ActorDeathEvent', 'ActorEvent', 'ActorExplodeEvent', 'ActorKnockbackEvent', 'ActorRemoveEvent', 'ActorSpawnEvent', 'ActorTeleportEvent', 'BanEntry', 'BarColor', 'BarFlag', 'BarStyle', 'Block', 'BlockBreakEvent', 'BlockBatch', 'BlockBatchResult', 'BlockData', 'BlockEvent', 'BlockFace', 'BlockPlaceEvent', 'BlockState', 'BlockVolume', 'BossBar', 'BroadcastMessageEvent', 'Cancellable', 'Chunk', 'ChunkBatchLoadEvent', 'ChunkEvent', 'ChunkLoadEvent', 'ChunkSnapshot', 'ChunkUnloadEvent', 'ColorFormat', 'Command', 'CommandExecutor', 'CommandSender', 'CommandSenderWrapper', 'ConsoleCommandSender', 'Criteria', 'DamageSource', 'Dimension', 'DimensionEvent', 'DisplaySlot', 'Divider', 'Dropdown', 'Enchantment', 'EnchantmentRegistry', 'EquipmentSlot', 'Event', 'EventPriority', 'GameMode', 'Header', 'Inventory', 'IpBanEntry', 'IpBanList', 'ItemFactory', 'ItemMeta', 'ItemRegistry', 'ItemStack', 'ItemType', 'Label', 'Language', 'LeavesDecayEvent', 'Level', 'LevelEvent', 'Location', 'Logger', 'MapCanvas', 'MapMeta', 'MapRenderer', 'MapView', 'MessageForm', 'Mob', 'MobEvent', 'ModalForm', 'NamespacedKey', 'Objective', 'ObjectiveSortOrder', 'OfflinePlayer', 'PacketReceiveEvent', 'PacketSendEvent', 'Permissible', 'Permission', 'PermissionAttachment', 'PermissionAttachmentInfo', 'PermissionDefault', 'PermissionLevel', 'Player', 'PlayerBanEntry', 'PlayerBanList', 'PlayerChatEvent', 'PlayerCommandEvent', 'PlayerDeathEvent', 'PlayerDropItemEvent', 'PlayerEmoteEvent', 'PlayerEvent', 'PlayerGameModeChangeEvent', 'PlayerInteractActorEvent', 'PlayerInteractEvent', 'PlayerInventory', 'PlayerItemConsumeEvent', 'PlayerJoinEvent', 'PlayerJumpEvent', 'PlayerKickEvent', 'PlayerLoginEvent', 'PlayerMoveEvent', 'PlayerPickupItemEvent', 'PlayerQuitEvent', 'PlayerRespawnEvent', 'PlayerTeleportEvent', 'Plugin', 'PluginCommand', 'PluginDescription', 'PluginDisableEvent', 'PluginEnableEvent', 'PluginLoadOrder', 'PluginLoader', 'PluginManager', 'Position', 'RenderType', 'Scheduler', 'Score', 'Scoreboard', 'ScriptMessageEvent', 'Server', 'ServerCommandEvent', 'ServerEvent', 'ServerListPingEvent', 'ServerLoadEvent', 'Service', 'ServiceManager', 'ServicePriority', 'Skin', 'Slider', 'SocketAddress', 'StepSlider', 'Task', 'TextInput', 'ThunderChangeEvent', 'Toggle', 'Translatable', 'Vector', 'WeatherChangeEvent', 'WeatherEvent']
 class ActionForm:
     """
     Represents a form with buttons that let the player take action.
@@ -105,6 +105,10 @@ class Actor(CommandSender):
         """
         Adds a tag to this actor.
         """
+    def get_nearby_actors(self, x: float, y: float, z: float) -> list[Actor]:
+        """
+        Gets the actors within a box centered on this actor, excluding this actor. The arguments are half the size of the box along each axis.
+        """
     def remove(self) -> None:
         """
         Remove this actor from the level.
@@ -237,6 +241,42 @@ class Actor(CommandSender):
         """
         Gets this actor's current velocity.
         """
+class ActorColumns:
+    """
+    The state of many actors at once, stored as one array per property. Row i of every array belongs to the same actor.
+    """
+    def __len__(self) -> int:
+        ...
+    @property
+    def health(self) -> numpy.ndarray[numpy.int32]:
+        """
+        Health of the actors
+        """
+    @property
+    def ids(self) -> numpy.ndarray[numpy.int64]:
+        """
+        Unique ids of the actors
+        """
+    @property
+    def positions(self) -> numpy.ndarray[numpy.float32]:
+        """
+        Positions of the actors' feet, one row of x, y and z per actor
+        """
+    @property
+    def type_names(self) -> list[str]:
+        """
+        The distinct actor types, e.g. minecraft:zombie
+        """
+    @property
+    def types(self) -> numpy.ndarray[numpy.uint16]:
+        """
+        Index of each actor's type in type_names
+        """
+    @property
+    def velocities(self) -> numpy.ndarray[numpy.float32]:
+        """
+        Velocities of the actors, one row of x, y and z per actor
+        """
 class ActorDamageEvent(MobEvent, Cancellable):
     """
     Called when an Actor is damaged.
@@ -540,6 +580,39 @@ class BlockBreakEvent(BlockEvent, Cancellable):
         """
         Gets the Player that is breaking the block involved in this event.
         """
+class BlockBatch:
+    """
+    Collects block changes in a dimension and applies them together, sending one packet per changed sub-chunk.
+    """
+    def __len__(self) -> int:
+        ...
+    def commit(self, update_neighbors: bool = True) -> BlockBatchResult:
+        """
+        Applies the queued changes and sends them to clients
+        """
+    def set_block(self, x: int, y: int, z: int, block: BlockData) -> None:
+        """
+        Queues a block change, replacing any change queued earlier at the same position
+        """
+class BlockBatchResult:
+    """
+    Summarises a committed BlockBatch.
+    """
+    @property
+    def blocks_changed(self) -> int:
+        """
+        The number of blocks that were changed.
+        """
+    @property
+    def packets_saved(self) -> int:
+        """
+        The number of packets each viewing player did not receive compared to one packet per block.
+        """
+    @property
+    def packets_sent(self) -> int:
+        """
+        The number of packets sent to each player viewing the changes, one per sub-chunk changed.
+        """
 class BlockData:
     """
     Represents the data related to a live block
@@ -684,6 +757,49 @@ class BlockState:
         """
         Gets the z-coordinate of this block state.
         """
+class BlockVolume:
+    """
+    Represents a cuboid of blocks, stored as a palette of block runtime IDs and one palette index per block.
+    """
+    def __init__(self, size_x: int, size_y: int, size_z: int, palette: list[int] = [], indices: numpy.ndarray[numpy.uint16] | None = None) -> None:
+        ...
+    def get_runtime_id(self, x: int, y: int, z: int) -> int:
+        """
+        Gets the runtime ID of the block at the given relative coordinates
+        """
+    @property
+    def indices(self) -> numpy.ndarray[numpy.uint16]:
+        """
+        The palette index of every block, ordered with Y varying fastest, then Z, then X
+        """
+    @property
+    def palette(self) -> list[int]:
+        """
+        The palette of block runtime IDs
+        """
+    @palette.setter
+    def palette(self, arg1: list[int]) -> None:
+        ...
+    @property
+    def size_x(self) -> int:
+        """
+        Gets the number of blocks along the X-axis
+        """
+    @property
+    def size_y(self) -> int:
+        """
+        Gets the number of blocks along the Y-axis
+        """
+    @property
+    def size_z(self) -> int:
+        """
+        Gets the number of blocks along the Z-axis
+        """
+    @property
+    def volume(self) -> int:
+        """
+        Gets the total number of blocks in this volume
+        """
 class BossBar:
     """
     Represents a boss bar that is displayed to players.
@@ -806,6 +922,10 @@ class Chunk:
         ...
     def __str__(self) -> str:
         ...
+    def get_snapshot(self) -> ChunkSnapshot:
+        """
+        Takes an immutable snapshot of the blocks and height map of this chunk
+        """
     @property
     def dimension(self) -> Dimension:
         """
@@ -826,6 +946,15 @@ class Chunk:
         """
         Gets the Z-coordinate of this chunk
         """
+class ChunkBatchLoadEvent(LevelEvent):
+    """
+    Called once per tick with all the chunks loaded during that tick
+    """
+    @property
+    def chunks(self) -> list[Chunk]:
+        """
+        Gets the chunks loaded during the last tick
+        """
 class ChunkEvent(DimensionEvent):
     """
     Represents a Chunk related event
@@ -839,6 +968,45 @@ class ChunkLoadEvent(ChunkEvent):
     """
     Called when a chunk is loaded
     """
+class ChunkSnapshot:
+    """
+    An immutable copy of the blocks and height map of a chunk, safe to read from any thread.
+    """
+    def __repr__(self) -> str:
+        ...
+    def get_highest_block_y_at(self, x: int, z: int) -> int:
+        """
+        Gets the Y-coordinate of the highest non-air block at the given coordinates, relative to the chunk
+        """
+    def get_runtime_id(self, x: int, y: int, z: int) -> int:
+        """
+        Gets the runtime ID of the block at the given coordinates, x and z being relative to the chunk
+        """
+    @property
+    def dimension_name(self) -> str:
+        """
+        Gets the name of the dimension this snapshot was taken from
+        """
+    @property
+    def max_height(self) -> int:
+        """
+        Gets the Y-coordinate above the highest block in the snapshot
+        """
+    @property
+    def min_height(self) -> int:
+        """
+        Gets the lowest Y-coordinate in the snapshot
+        """
+    @property
+    def x(self) -> int:
+        """
+        Gets the X-coordinate of the chunk
+        """
+    @property
+    def z(self) -> int:
+        """
+        Gets the Z-coordinate of the chunk
+        """
 class ChunkUnloadEvent(ChunkEvent):
     """
     Called when a chunk is unloaded
@@ -1099,6 +1267,32 @@ class Dimension:
     NETHER: typing.ClassVar[Dimension.Type]  # value = <Type.NETHER: 1>
     OVERWORLD: typing.ClassVar[Dimension.Type]  # value = <Type.OVERWORLD: 0>
     THE_END: typing.ClassVar[Dimension.Type]  # value = <Type.THE_END: 2>
+    def begin_block_batch(self) -> BlockBatch:
+        """
+        Starts collecting block changes to be applied together.
+        """
+    def cancel_block_writes(self, plugin: Plugin) -> None:
+        """
+        Cancels the pending block writes made by a plugin.
+        """
+    def fill(self, plugin: Plugin, x1: int, y1: int, z1: int, x2: int, y2: int, z2: int, block: BlockData, *, update_neighbors: bool = True, update_clients: bool = True, max_blocks_per_tick: int = 0, on_complete: typing.Callable[[], None] | None = None) -> None:
+        """
+        Fills a cuboid with a single block, corners inclusive. Every chunk it overlaps must be loaded, pending writes are cancelled when the plugin is disabled.
+        """
+    def for_each_loaded_chunk(self, visitor: typing.Callable[[int, int], bool | None]) -> None:
+        """
+        Calls a function with the coordinates of each loaded chunk, returning False stops the iteration. The visitor must not load or unload chunks.
+        """
+    @typing.overload
+    def get_actor_columns(self) -> ActorColumns:
+        """
+        Gets the state of every actor in this dimension in a single pass.
+        """
+    @typing.overload
+    def get_actor_columns(self, min: Vector, max: Vector) -> ActorColumns:
+        """
+        Gets the state of the actors whose bounding box intersects a box in a single pass.
+        """
     @typing.overload
     def get_block_at(self, location: Location) -> Block:
         """
@@ -1109,6 +1303,10 @@ class Dimension:
         """
         Gets the Block at the given coordinates
         """
+    def get_blocks(self, x1: int, y1: int, z1: int, x2: int, y2: int, z2: int) -> BlockVolume:
+        """
+        Reads the blocks in a cuboid, corners inclusive. Every chunk it overlaps must be loaded.
+        """
     @typing.overload
     def get_highest_block_at(self, location: Location) -> Block:
         """
@@ -1119,16 +1317,41 @@ class Dimension:
         """
         Gets the highest non-empty (impassable) block at the given coordinates.
         """
+    @typing.overload
     def get_highest_block_y_at(self, x: int, z: int) -> int:
         """
         Gets the highest non-empty (impassable) coordinate at the given coordinates.
         """
+    @typing.overload
+    def get_highest_block_y_at(self, xs: list[int], zs: list[int]) -> list[int]:
+        """
+        Gets the highest non-empty (impassable) coordinates of many columns at once, scanning each distinct column once.
+        """
+    @typing.overload
+    def get_nearby_actors(self, center: Vector, radius: float, type: str | None = None) -> list[Actor]:
+        """
+        Gets the actors within a given distance of a position, optionally only those of the given type.
+        """
+    @typing.overload
+    def get_nearby_actors(self, min: Vector, max: Vector, type: str | None = None) -> list[Actor]:
+        """
+        Gets the actors whose bounding box intersects a box, optionally only those of the given type.
+        """
+    def set_blocks(self, plugin: Plugin, x: int, y: int, z: int, volume: BlockVolume, *, update_neighbors: bool = True, update_clients: bool = True, max_blocks_per_tick: int = 0, on_complete: typing.Callable[[], None] | None = None) -> None:
+        """
+        Writes the blocks of a volume into this dimension, starting at its minimum corner. Every chunk it overlaps must be loaded, pending writes are cancelled when the plugin is disabled.
+        """
     @property
     def level(self) -> Level:
         """
         Gets the level to which this dimension belongs
         """
     @property
+    def loaded_chunk_count(self) -> int:
+        """
+        Gets the number of loaded chunks
+        """
+    @property
     def loaded_chunks(self) -> list[Chunk]:
         """
         Gets a list of all loaded Chunks
@@ -2469,6 +2692,12 @@ class PacketReceiveEvent(ServerEvent, Cancellable):
         Gets the network address to which this packet is being sent.
         """
     @property
+    def mutable_payload(self) -> memoryview:
+        """
+        Gets a writable memoryview of the raw packet data **excluding** the header for same-length edits.
+        NOTE: The view is released when the event handler returns or the payload is replaced.
+        """
+    @property
     def packet_id(self) -> int:
         """
         Gets the ID of the packet.
@@ -2482,6 +2711,12 @@ class PacketReceiveEvent(ServerEvent, Cancellable):
     def payload(self, arg1: bytes) -> None:
         ...
     @property
+    def payload_view(self) -> memoryview:
+        """
+        Gets a read-only memoryview of the raw packet data **excluding** the header without copying it.
+        NOTE: The view is released when the event handler returns or the payload is replaced. Copy the data, e.g. with bytes(view), to keep it. Views derived from it, such as slices, must not be kept either.
+        """
+    @property
     def player(self) -> Player:
         """
         Gets the player involved in this event
@@ -2502,6 +2737,12 @@ class PacketSendEvent(ServerEvent, Cancellable):
         Gets the network address to which this packet is being sent.
         """
     @property
+    def mutable_payload(self) -> memoryview:
+        """
+        Gets a writable memoryview of the raw packet data **excluding** the header for same-length edits.
+        NOTE: The view is released when the event handler returns or the payload is replaced.
+        """
+    @property
     def packet_id(self) -> int:
         """
         Gets the ID of the packet.
@@ -2515,6 +2756,12 @@ class PacketSendEvent(ServerEvent, Cancellable):
     def payload(self, arg1: bytes) -> None:
         ...
     @property
+    def payload_view(self) -> memoryview:
+        """
+        Gets a read-only memoryview of the raw packet data **excluding** the header without copying it.
+        NOTE: The view is released when the event handler returns or the payload is replaced. Copy the data, e.g. with bytes(view), to keep it. Views derived from it, such as slices, must not be kept either.
+        """
+    @property
     def player(self) -> Player:
         """
         Gets the player involved in this event
@@ -2883,6 +3130,16 @@ class Player(Mob, OfflinePlayer):
         Get the player's current device's operation system (OS).
         """
     @property
+    def dropped_packet_bytes(self) -> int:
+        """
+        Gets the total size in bytes of the packets from this player that have been dropped by the packet rate limiter.
+        """
+    @property
+    def dropped_packet_count(self) -> int:
+        """
+        Gets the number of packets from this player that have been dropped by the packet rate limiter.
+        """
+    @property
     def exp_level(self) -> int:
         """
         Gets or sets the players current experience level.
@@ -3819,6 +4076,10 @@ class Scheduler:
         """
         Returns a task that will be executed synchronously
         """
+    def run_task_async(self, plugin: Plugin, task: typing.Callable[[], None], delay: int = 0, period: int = 0) -> Task:
+        """
+        Returns a task that will be executed asynchronously on a worker thread
+        """
 class Score:
     """
     Represents a score for an objective on a scoreboard.
@@ -3964,6 +4225,18 @@ class Server:
         """
         Reload only the Minecraft data for the server.
         """
+    def remove_server_list_ping_override(self, plugin: Plugin, host: str) -> None:
+        """
+        Removes the override for the server list ping responses sent to the given host.
+        """
+    def remove_server_list_ping_overrides(self, plugin: Plugin) -> None:
+        """
+        Removes all the server list ping overrides set by the given plugin.
+        """
+    def set_server_list_ping_override(self, plugin: Plugin, host: str, override: typing.Callable[[ServerListPingEvent], None]) -> None:
+        """
+        Sets an override for the server list ping responses sent to the given host, or to all hosts if the host is empty. The override is only called when the cached ping response is rebuilt, and is removed when the plugin is disabled.
+        """
     def shutdown(self) -> None:
         """
         Shutdowns the server, stopping everything.
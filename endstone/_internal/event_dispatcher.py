@@ -0,0 +1,103 @@
+from __future__ import annotations
+
+import traceback
+import typing
+
+from endstone.event import Cancellable, Event, EventPriority
+
+if typing.TYPE_CHECKING:
+    from endstone.plugin import Plugin, PluginManager
+
+__all__ = ["EventDispatcher", "event_dispatcher"]
+
+
+class _Handler:
+    __slots__ = ("executor", "plugin", "ignore_cancelled")
+
+    def __init__(self, executor: typing.Callable[[Event], None], plugin: Plugin, ignore_cancelled: bool):
+        self.executor = executor
+        self.plugin = plugin
+        self.ignore_cancelled = ignore_cancelled
+
+
+class _HandlerGroup:
+    """
+    All Python handlers for an event at one priority, registered with the plugin manager as a single handler.
+
+    The event crosses into Python once per group, so the GIL is acquired and the wrapper type of the event is
+    resolved once no matter how many handlers, or how many plugins, are invoked. The registration belongs to
+    ``owner``, one of the plugins that have handlers in the group.
+    """
+
+    def __init__(self, name: str, priority: EventPriority, owner: Plugin):
+        self.name = name
+        self.priority = priority
+        self.owner = owner
+        self.handlers: list[_Handler] = []  # replaced rather than mutated, so dispatch never sees a partial update
+
+    def __call__(self, event: Event) -> None:
+        cancellable = isinstance(event, Cancellable)
+        for handler in self.handlers:
+            plugin = handler.plugin
+            if not plugin.is_enabled:
+                continue
+
+            if handler.ignore_cancelled and cancellable and event.is_cancelled:
+                continue
+
+            try:
+                handler.executor(event)
+            except Exception:
+                plugin.server.logger.error(
+                    f"Could not pass event {self.name} to plugin {plugin.name}.\n{traceback.format_exc()}"
+                )
+
+
+class EventDispatcher:
+    """
+    Groups the event handlers of Python plugins by event and priority.
+
+    Handlers run in the order they were added. A group keeps the registration it was given when its first handler
+    was added, so its position relative to other handlers of the same priority does not change, unless the plugin
+    owning the registration is disabled while other plugins still have handlers in the group. The group is then
+    registered again under one of those plugins, see unregister.
+    """
+
+    def __init__(self):
+        self._groups: dict[tuple[str, EventPriority], _HandlerGroup] = {}
+
+    def register(
+        self,
+        plugin_manager: PluginManager,
+        name: str,
+        executor: typing.Callable[[Event], None],
+        priority: EventPriority,
+        plugin: Plugin,
+        ignore_cancelled: bool,
+    ) -> None:
+        key = (name, priority)
+        group = self._groups.get(key)
+        if group is None:
+            group = self._groups[key] = _HandlerGroup(name, priority, plugin)
+            plugin_manager.register_event(name, group, priority, plugin, False)
+
+        group.handlers = group.handlers + [_Handler(executor, plugin, ignore_cancelled)]
+
+    def unregister(self, plugin: Plugin) -> None:
+        """
+        Removes the handlers of a plugin that is being disabled. Called before the plugin manager drops the
+        registrations of the plugin, see PythonPluginLoader.disable_plugin.
+        """
+        for key, group in list(self._groups.items()):
+            handlers = [handler for handler in group.handlers if handler.plugin is not plugin]
+            if not handlers:
+                del self._groups[key]
+                continue
+
+            group.handlers = handlers
+            if group.owner is plugin:
+                group.owner = handlers[0].plugin
+                group.owner.server.plugin_manager.register_event(group.name, group, group.priority, group.owner, False)
+
+
+event_dispatcher = EventDispatcher()
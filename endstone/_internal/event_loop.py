@@ -0,0 +1,134 @@
+from __future__ import annotations
+
+import asyncio
+import heapq
+import itertools
+import traceback
+import typing
+
+if typing.TYPE_CHECKING:
+    from endstone import Server
+    from endstone.plugin import Plugin
+
+__all__ = ["EndstoneEventLoop", "get_event_loop", "next_tick", "wait_ticks", "run_async"]
+
+T = typing.TypeVar("T")
+
+
+class EndstoneEventLoop(asyncio.SelectorEventLoop):
+    """
+    An asyncio event loop driven by the server instead of running on a thread of its own.
+
+    Every server tick the scheduler calls `heartbeat` on the main thread, which wakes up the coroutines waiting
+    for that tick and then runs ready callbacks until there are none left or the time budget is used up.
+    """
+
+    def __init__(self, server: Server, time_budget: float = 0.005):
+        super().__init__()
+        self._server = server
+        self._current_tick = 0
+        self._tick_waiters: list[tuple[int, int, asyncio.Future]] = []
+        self._counter = itertools.count()
+        self.time_budget = time_budget
+        self.set_exception_handler(self._handle_exception)
+
+    @property
+    def current_tick(self) -> int:
+        return self._current_tick
+
+    def create_tick_future(self, ticks: int = 1) -> asyncio.Future:
+        """Returns a future resolved with the tick number once the given number of ticks has passed."""
+        future = self.create_future()
+        heapq.heappush(self._tick_waiters, (self._current_tick + max(ticks, 1), next(self._counter), future))
+        return future
+
+    def heartbeat(self, current_tick: int) -> None:
+        self._current_tick = current_tick
+        waiters = self._tick_waiters
+        while waiters and waiters[0][0] <= current_tick:
+            _, _, future = heapq.heappop(waiters)
+            if not future.done():
+                future.set_result(current_tick)
+
+        # stop() followed by run_forever() runs exactly one iteration, polling for I/O without blocking
+        deadline = self.time() + self.time_budget
+        while True:
+            self.stop()
+            self.run_forever()
+            if not self._ready or self.time() >= deadline:
+                break
+
+    def shutdown(self) -> None:
+        for task in asyncio.all_tasks(self):
+            task.cancel()
+        for _, _, future in self._tick_waiters:
+            future.cancel()
+        self._tick_waiters.clear()
+
+        # let the cancelled tasks unwind before closing the loop
+        self.stop()
+        self.run_forever()
+        self.close()
+
+    def _handle_exception(self, loop: asyncio.AbstractEventLoop, context: dict) -> None:
+        message = context.get("message", "Unhandled exception in event loop")
+        exception = context.get("exception")
+        if exception is not None:
+            message += "\n" + "".join(traceback.format_exception(type(exception), exception, exception.__traceback__))
+        self._server.logger.error(message)
+
+
+_loop: EndstoneEventLoop | None = None
+
+
+def _set_event_loop(loop: EndstoneEventLoop | None) -> None:
+    global _loop
+    _loop = loop
+    asyncio.set_event_loop(loop)
+
+
+def get_event_loop() -> EndstoneEventLoop:
+    """Returns the event loop driven by the server's main thread."""
+    if _loop is None:
+        raise RuntimeError("The endstone event loop is not running")
+    return _loop
+
+
+def next_tick() -> asyncio.Future:
+    """Returns an awaitable that resolves on the next server tick."""
+    return get_event_loop().create_tick_future(1)
+
+
+def wait_ticks(ticks: int) -> asyncio.Future:
+    """Returns an awaitable that resolves once the given number of server ticks has passed."""
+    return get_event_loop().create_tick_future(ticks)
+
+
+def run_async(plugin: Plugin, func: typing.Callable[..., T], *args: typing.Any) -> asyncio.Future[T]:
+    """
+    Runs a function on the scheduler's worker threads and returns an awaitable for its result.
+
+    The returned future is completed on the main thread.
+    """
+    loop = get_event_loop()
+    future = loop.create_future()
+
+    def set_result(result):
+        if not future.done():
+            future.set_result(result)
+
+    def set_exception(exception):
+        if not future.done():
+            future.set_exception(exception)
+
+    def run():
+        try:
+            result = func(*args)
+        except BaseException as e:
+            loop.call_soon_threadsafe(set_exception, e)
+        else:
+            loop.call_soon_threadsafe(set_result, result)
+
+    if plugin.server.scheduler.run_task_async(plugin, run) is None:
+        future.set_exception(RuntimeError(f"Plugin {plugin.name} could not schedule an async task"))
+    return future
@@ -0,0 +1,139 @@
+from __future__ import annotations
+
+import asyncio
+import concurrent.futures
+import enum
+import os
+import sys
+import sysconfig
+import typing
+
+from endstone._internal.event_loop import get_event_loop
+
+__all__ = ["ExecutionMode", "get_execution_mode", "run_parallel", "share", "shutdown_executors"]
+
+T = typing.TypeVar("T")
+
+
+class ExecutionMode(enum.Enum):
+    """
+    Where Python work submitted with `run_parallel` is executed.
+    """
+
+    AUTO = "auto"
+    """
+    Picks FREE_THREADED on a free-threaded build and THREAD otherwise. SUBINTERPRETER must be requested explicitly.
+
+    On a build with the GIL, AUTO therefore never runs Python code in parallel: it only moves the work off the main
+    thread. Request SUBINTERPRETER to spread CPU-bound work over several cores there.
+    """
+
+    THREAD = "thread"
+    """Worker threads sharing the interpreter and its GIL with the main thread."""
+
+    SUBINTERPRETER = "subinterpreter"
+    """Worker threads each running an isolated sub-interpreter with its own GIL (PEP 684, Python 3.14+)."""
+
+    FREE_THREADED = "free_threaded"
+    """Worker threads on a free-threaded build of CPython with the GIL disabled (PEP 703)."""
+
+
+def _is_free_threaded() -> bool:
+    if not sysconfig.get_config_var("Py_GIL_DISABLED"):
+        return False
+    # the GIL is re-enabled at runtime as soon as an extension module not declaring support for it is imported
+    is_gil_enabled = getattr(sys, "_is_gil_enabled", None)
+    return is_gil_enabled is not None and not is_gil_enabled()
+
+
+def _supports_subinterpreters() -> bool:
+    return hasattr(concurrent.futures, "InterpreterPoolExecutor")
+
+
+def get_execution_mode(mode: ExecutionMode = ExecutionMode.AUTO) -> ExecutionMode:
+    """
+    Resolves the mode that will actually be used for the requested one.
+
+    Raises:
+        RuntimeError: If the requested mode is not supported by the running interpreter.
+    """
+    if mode is ExecutionMode.AUTO:
+        # plugin modules and endstone cannot be imported in sub-interpreters, so they are never picked implicitly
+        if _is_free_threaded():
+            return ExecutionMode.FREE_THREADED
+        return ExecutionMode.THREAD
+
+    if mode is ExecutionMode.FREE_THREADED and not _is_free_threaded():
+        raise RuntimeError("The running interpreter is not a free-threaded build, or the GIL has been re-enabled")
+    if mode is ExecutionMode.SUBINTERPRETER and not _supports_subinterpreters():
+        raise RuntimeError("Sub-interpreters with their own GIL require Python 3.14 or later")
+    return mode
+
+
+_executors: dict[ExecutionMode, concurrent.futures.Executor] = {}
+
+
+def _get_executor(mode: ExecutionMode) -> concurrent.futures.Executor:
+    executor = _executors.get(mode)
+    if executor is None:
+        workers = os.cpu_count() or 1
+        if mode is ExecutionMode.SUBINTERPRETER:
+            executor = concurrent.futures.InterpreterPoolExecutor(max_workers=workers)
+        else:
+            executor = concurrent.futures.ThreadPoolExecutor(max_workers=workers, thread_name_prefix="endstone-py")
+        _executors[mode] = executor
+    return executor
+
+
+def shutdown_executors() -> None:
+    for executor in _executors.values():
+        executor.shutdown(wait=False, cancel_futures=True)
+    _executors.clear()
+
+
+_SHAREABLE_SCALARS = (type(None), bool, int, float, complex, str, bytes)
+
+
+def share(obj: typing.Any) -> typing.Any:
+    """
+    Converts a value into an immutable form that can be passed to and returned from a sub-interpreter.
+
+    Scalars (None, bool, int, float, complex, str, bytes) are returned as-is, bytearray becomes bytes, lists and
+    tuples become tuples, sets become frozensets and dicts become tuples of (key, value) pairs. Everything is
+    converted recursively.
+
+    Sub-interpreters cannot share objects with the main interpreter, and the endstone module cannot be imported in
+    them, so server objects such as players or worlds must be reduced to plain data with this function first.
+
+    Raises:
+        TypeError: If the value contains anything else.
+    """
+    if isinstance(obj, _SHAREABLE_SCALARS):
+        return obj
+    if isinstance(obj, bytearray):
+        return bytes(obj)
+    if isinstance(obj, (list, tuple)):
+        return tuple(share(item) for item in obj)
+    if isinstance(obj, (set, frozenset)):
+        return frozenset(share(item) for item in obj)
+    if isinstance(obj, dict):
+        return tuple((share(key), share(value)) for key, value in obj.items())
+    raise TypeError(f"Object of type {type(obj).__name__} cannot be shared across interpreters")
+
+
+def run_parallel(
+    func: typing.Callable[..., T], *args: typing.Any, mode: ExecutionMode = ExecutionMode.AUTO
+) -> asyncio.Future[T]:
+    """
+    Runs a function outside of the main interpreter's GIL and returns an awaitable for its result.
+
+    In SUBINTERPRETER mode the arguments are passed through `share` and the function is pickled by reference, so it
+    must be defined at module level in a module that does not import endstone. In the other modes the arguments are
+    passed unchanged. In THREAD mode the work still competes with the main thread for the GIL, which is what AUTO
+    resolves to on a build with the GIL. The returned future is completed on the main thread.
+    """
+    mode = get_execution_mode(mode)
+    if mode is ExecutionMode.SUBINTERPRETER:
+        args = tuple(share(arg) for arg in args)
+    loop = get_event_loop()
+    return loop.run_in_executor(_get_executor(mode), func, *args)
@@ -1,21 +1,28 @@
 from __future__ import annotations
 
 import glob
+import hashlib
 import importlib
+import json
 import os
 import os.path
 import shutil
 import site
 import subprocess
 import sys
+import sysconfig
+import time
 import traceback
 import warnings
 
 import pkginfo
-from importlib_metadata import EntryPoint, distribution, entry_points, metadata
+from importlib_metadata import EntryPoint, distribution, distributions, entry_points, metadata
 
 from endstone import Server
+from endstone._internal.event_dispatcher import event_dispatcher
+from endstone._internal.event_loop import EndstoneEventLoop, _set_event_loop
 from endstone._internal.metrics import Metrics
+from endstone._internal.parallel import shutdown_executors
 from endstone.command import Command
 from endstone.permissions import Permission, PermissionDefault
 from endstone.plugin import Plugin, PluginDescription, PluginLoader, PluginLoadOrder
@@ -47,6 +54,14 @@ def find_python():
     raise RuntimeError(f"Unable to find Python executable. Attempted paths: {paths}")
 
 
+def hash_file(path: str) -> str:
+    sha256 = hashlib.sha256()
+    with open(path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            sha256.update(chunk)
+    return sha256.hexdigest()
+
+
 class PythonPluginLoader(PluginLoader):
     SUPPORTED_API = ["0.5", "0.6", "0.7", "0.8", "0.9"]
 
@@ -65,17 +80,34 @@ class PythonPluginLoader(PluginLoader):
             if module.startswith("endstone_"):
                 del sys.modules[module]
 
-        # prepare the temp site-dir
+        # prepare the site-dir, wheels installed here are reused across restarts as long as they are unchanged
         self._prefix = os.path.join("plugins", ".local")
-        shutil.rmtree(self._prefix, ignore_errors=True)
-        for site_dir in site.getsitepackages(prefixes=[self._prefix]):
+        self._manifest_path = os.path.join(self._prefix, "manifest.json")
+        self._abi = f"{sys.implementation.cache_tag}-{sysconfig.get_platform()}"
+        self._manifest = self._read_manifest()
+        if self._manifest.get("abi") != self._abi:
+            shutil.rmtree(self._prefix, ignore_errors=True)
+            self._manifest = {"abi": self._abi, "wheels": {}}
+
+        self._site_dirs = site.getsitepackages(prefixes=[self._prefix])
+        for site_dir in self._site_dirs:
             site.addsitedir(site_dir)
 
         # initialize the metrics
         self._metrics = Metrics(self.server)
 
+        # initialize the event loop driven by the scheduler heartbeat
+        self._loop = EndstoneEventLoop(self.server)
+        _set_event_loop(self._loop)
+
     def __del__(self):
         self._metrics.shutdown()
+        shutdown_executors()
+        _set_event_loop(None)
+        self._loop.shutdown()
+
+    def _heartbeat(self, current_tick: int) -> None:
+        self._loop.heartbeat(current_tick)
 
     @staticmethod
     def _build_commands(commands: dict) -> list[Command]:
@@ -103,25 +135,9 @@ class PythonPluginLoader(PluginLoader):
         return results
 
     def load_plugin(self, file: str) -> Plugin | None:
-        env = os.environ.copy()
-        env.pop("LD_PRELOAD", "")
-
-        dist_name = pkginfo.Wheel(file).name
-        subprocess.run(
-            [
-                sys.executable,
-                "-m",
-                "pip",
-                "install",
-                file,
-                "--prefix",
-                self._prefix,
-                "--quiet",
-                "--no-warn-script-location",
-                "--disable-pip-version-check",
-            ],
-            env=env,
-        )
+        dist_name = self._install_wheels([file]).get(file)
+        if dist_name is None:
+            return None
 
         eps = distribution(dist_name).entry_points.select(group="endstone")
         for ep in eps:
@@ -131,23 +147,148 @@ class PythonPluginLoader(PluginLoader):
 
         return None
 
+    def disable_plugin(self, plugin: Plugin) -> None:
+        PluginLoader.disable_plugin(self, plugin)
+        event_dispatcher.unregister(plugin)
+
     def load_plugins(self, directory: str) -> list[Plugin]:
         loaded_plugins = []
 
         if not self._plugins:
             eps = entry_points(group="endstone")
             for ep in eps:
+                # plugins installed from wheels are loaded below, only if the wheel is still there
+                if self._is_local(ep):
+                    continue
+
                 plugin = self._load_plugin_from_ep(ep)
                 if plugin:
                     loaded_plugins.append(plugin)
 
-        for file in glob.glob(os.path.join(directory, "*.whl")):
-            plugin = self.load_plugin(file)
-            if plugin:
-                loaded_plugins.append(plugin)
+        files = sorted(glob.glob(os.path.join(directory, "*.whl")))
+        installed = self._install_wheels(files, prune=True)
+        for file in files:
+            dist_name = installed.get(file)
+            if dist_name is None:
+                continue
+
+            for ep in distribution(dist_name).entry_points.select(group="endstone"):
+                plugin = self._load_plugin_from_ep(ep)
+                if plugin:
+                    loaded_plugins.append(plugin)
+                    break
 
         return loaded_plugins
 
+    def _read_manifest(self) -> dict:
+        try:
+            with open(self._manifest_path, "r", encoding="utf-8") as f:
+                manifest = json.load(f)
+            if isinstance(manifest, dict) and isinstance(manifest.get("wheels"), dict):
+                return manifest
+        except (OSError, ValueError):
+            pass
+        return {}
+
+    def _write_manifest(self) -> None:
+        os.makedirs(self._prefix, exist_ok=True)
+        tmp_path = self._manifest_path + ".tmp"
+        with open(tmp_path, "w", encoding="utf-8") as f:
+            json.dump(self._manifest, f, indent=2)
+        os.replace(tmp_path, self._manifest_path)
+
+    def _is_local(self, ep: EntryPoint) -> bool:
+        location = os.path.abspath(str(ep.dist.locate_file("")))
+        return any(os.path.abspath(site_dir) == location for site_dir in self._site_dirs)
+
+    def _uninstall(self, dist_name: str) -> None:
+        # remove the files recorded for a distribution previously installed into the prefix
+        for dist in distributions(name=dist_name, path=self._site_dirs):
+            for path in dist.files or []:
+                try:
+                    os.remove(dist.locate_file(path))
+                except OSError:
+                    pass
+            shutil.rmtree(str(dist._path), ignore_errors=True)  # noqa
+
+    def _pip_install(self, files: list[str]) -> bool:
+        env = os.environ.copy()
+        env.pop("LD_PRELOAD", "")
+
+        result = subprocess.run(
+            [
+                sys.executable,
+                "-m",
+                "pip",
+                "install",
+                *files,
+                "--prefix",
+                self._prefix,
+                "--quiet",
+                "--no-warn-script-location",
+                "--disable-pip-version-check",
+            ],
+            env=env,
+        )
+        return result.returncode == 0
+
+    def _install_wheels(self, files: list[str], prune: bool = False) -> dict[str, str]:
+        """Installs the given wheels into the prefix, skipping those whose content is unchanged since the last install.
+
+        Returns a mapping from each successfully installed wheel to its distribution name.
+        """
+        wheels = self._manifest["wheels"]
+        installed = {}
+        pending = {}
+
+        for file in files:
+            try:
+                digest = hash_file(file)
+                dist_name = pkginfo.Wheel(file).name
+            except Exception as e:
+                self.server.logger.error(f"Error occurred when trying to read wheel '{file}': {e}")
+                continue
+
+            entry = wheels.get(dist_name)
+            cached = entry is not None and entry["sha256"] == digest
+            if cached and any(distributions(name=dist_name, path=self._site_dirs)):
+                installed[file] = dist_name
+            else:
+                pending[file] = (dist_name, digest)
+
+        if prune:
+            present = set(installed.values()) | {dist_name for dist_name, _ in pending.values()}
+            for dist_name in list(wheels.keys()):
+                if dist_name not in present:
+                    self._uninstall(dist_name)
+                    del wheels[dist_name]
+
+        if pending:
+            for dist_name, _ in pending.values():
+                self._uninstall(dist_name)
+
+            start = time.perf_counter()
+            if self._pip_install(list(pending.keys())):
+                succeeded = list(pending.keys())
+            else:
+                # fall back to one install per wheel so a single broken wheel does not take down the others
+                succeeded = [file for file in pending if self._pip_install([file])]
+
+            for file in succeeded:
+                dist_name, digest = pending[file]
+                wheels[dist_name] = {"file": os.path.basename(file), "sha256": digest}
+                installed[file] = dist_name
+
+            self.server.logger.info(
+                f"Installed {len(succeeded)} plugin wheel(s) in {time.perf_counter() - start:.2f} seconds."
+            )
+
+        if pending or prune:
+            importlib.invalidate_caches()
+            self._write_manifest()
+
+        return installed
+
     def _load_plugin_from_ep(self, ep: EntryPoint) -> Plugin | None:
         # enforce naming convention
         if not ep.dist.name.replace("_", "-").startswith("endstone-"):
@@ -175,6 +316,7 @@ class PythonPluginLoader(PluginLoader):
             return None
 
         # get distribution metadata
+        start = time.perf_counter()
         try:
             plugin_metadata = metadata(ep.dist.name).json
             cls = ep.load()
@@ -238,4 +380,7 @@ class PythonPluginLoader(PluginLoader):
 
         plugin._description = plugin_description
         self._plugins.append(plugin)
+        self.server.logger.debug(
+            f"Imported plugin '{name}' from entry point '{ep.name}' in {(time.perf_counter() - start) * 1000:.1f} ms."
+        )
         return plugin
@@ -1,3 +1,3 @@
-from endstone._internal.endstone_python import Actor, Mob
+from endstone._internal.endstone_python import Actor, ActorColumns, Mob
 
-__all__ = ["Actor", "Mob"]
+__all__ = ["Actor", "ActorColumns", "Mob"]
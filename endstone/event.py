@@ -12,6 +12,7 @@ from endstone._internal.endstone_python import (
     BlockPlaceEvent,
     BroadcastMessageEvent,
     Cancellable,
+    ChunkBatchLoadEvent,
     ChunkEvent,
     ChunkLoadEvent,
     ChunkUnloadEvent,
@@ -68,6 +69,7 @@ __all__ = [
     "BlockBreakEvent",
     "BlockPlaceEvent",
     "Cancellable",
+    "ChunkBatchLoadEvent",
     "ChunkEvent",
     "ChunkLoadEvent",
     "ChunkUnloadEvent",
@@ -1,7 +1,21 @@
-from endstone._internal.endstone_python import Chunk, Dimension, Level, Location, Position
+from endstone._internal.endstone_python import (
+    BlockBatch,
+    BlockBatchResult,
+    BlockVolume,
+    Chunk,
+    ChunkSnapshot,
+    Dimension,
+    Level,
+    Location,
+    Position,
+)
 
 __all__ = [
+    "BlockBatch",
+    "BlockBatchResult",
+    "BlockVolume",
     "Chunk",
+    "ChunkSnapshot",
     "Dimension",
     "Level",
     "Location",
@@ -18,6 +18,7 @@ from endstone._internal.endstone_python import (
     ServiceManager,
     ServicePriority,
 )
+from endstone._internal.event_dispatcher import event_dispatcher
 from endstone.event import Event
 
 __all__ = [
@@ -101,8 +102,13 @@ class Plugin(endstone_python.Plugin):
             event_cls = params[0].annotation
             priority = getattr(func, "_priority")
             ignore_cancelled = getattr(func, "_ignore_cancelled")
-            self.server.plugin_manager.register_event(
-                getattr(event_cls, "NAME", event_cls.__name__), func, priority, self, ignore_cancelled
+            event_dispatcher.register(
+                self.server.plugin_manager,
+                getattr(event_cls, "NAME", event_cls.__name__),
+                func,
+                priority,
+                self,
+                ignore_cancelled,
             )
 
     @property
@@ -1,3 +1,16 @@
 from endstone._internal.endstone_python import Scheduler, Task
+from endstone._internal.event_loop import get_event_loop, next_tick, run_async, wait_ticks
+from endstone._internal.parallel import ExecutionMode, get_execution_mode, run_parallel, share
 
-__all__ = ["Scheduler", "Task"]
+__all__ = [
+    "ExecutionMode",
+    "Scheduler",
+    "Task",
+    "get_event_loop",
+    "get_execution_mode",
+    "next_tick",
+    "run_async",
+    "run_parallel",
+    "share",
+    "wait_ticks",
+]
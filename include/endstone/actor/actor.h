@@ -247,6 +247,16 @@ public:
      * @param score The new score tag to set.
      */
     virtual void setScoreTag(std::string score) = 0;
+
+    /**
+     * @brief Gets the actors within a box centered on this actor, excluding this actor.
+     *
+     * @param x Half the size of the box along the X-axis
+     * @param y Half the size of the box along the Y-axis
+     * @param z Half the size of the box along the Z-axis
+     * @return The actors whose bounding box intersects the box
+     */
+    [[nodiscard]] virtual std::vector<Actor *> getNearbyActors(float x, float y, float z) const = 0;
 };
 
 }  // namespace endstone
@@ -0,0 +1,72 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace endstone {
+
+/**
+ * @brief The state of many actors at once, stored as one array per property.
+ *
+ * Element i of every array belongs to the same actor. Vectors are stored as consecutive x, y and z components, so
+ * positions and velocities hold three floats per actor.
+ */
+struct ActorColumns {
+    /**
+     * @brief Unique ids of the actors, see Actor::getId
+     */
+    std::vector<std::int64_t> ids;
+
+    /**
+     * @brief Positions of the actors' feet, see Actor::getLocation
+     */
+    std::vector<float> positions;
+
+    /**
+     * @brief Velocities of the actors, see Actor::getVelocity
+     */
+    std::vector<float> velocities;
+
+    /**
+     * @brief Index of each actor's type in type_names
+     */
+    std::vector<std::uint16_t> types;
+
+    /**
+     * @brief Health of the actors, see Actor::getHealth
+     */
+    std::vector<std::int32_t> health;
+
+    /**
+     * @brief The distinct actor types, e.g. minecraft:zombie
+     */
+    std::vector<std::string> type_names;
+
+    /**
+     * @brief Gets the number of actors
+     *
+     * @return Number of actors
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        return ids.size();
+    }
+};
+
+}  // namespace endstone
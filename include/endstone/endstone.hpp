@@ -25,6 +25,7 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #endif
 
 #include "actor/actor.h"
+#include "actor/actor_columns.h"
 #include "actor/mob.h"
 #include "ban/ban_entry.h"
 #include "ban/ban_list.h"
@@ -63,6 +64,7 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "event/block/block_place_event.h"
 #include "event/block/leaves_decay_event.h"
 #include "event/cancellable.h"
+#include "event/chunk/chunk_batch_load_event.h"
 #include "event/chunk/chunk_event.h"
 #include "event/chunk/chunk_load_event.h"
 #include "event/chunk/chunk_unload_event.h"
@@ -127,7 +129,10 @@ static_assert(_ITERATOR_DEBUG_LEVEL == 0,
 #include "inventory/recipe.h"
 #include "lang/language.h"
 #include "lang/translatable.h"
+#include "level/block_batch.h"
+#include "level/block_volume.h"
 #include "level/chunk.h"
+#include "level/chunk_snapshot.h"
 #include "level/dimension.h"
 #include "level/level.h"
 #include "level/location.h"
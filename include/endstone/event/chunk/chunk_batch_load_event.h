@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "endstone/event/level/level_event.h"
+#include "endstone/level/chunk.h"
+
+namespace endstone {
+
+/**
+ * @brief Called once per tick with all the chunks loaded during that tick
+ *
+ * Prefer this over ChunkLoadEvent when a plugin only needs to know which chunks were loaded, as the event is
+ * dispatched once per tick instead of once per chunk.
+ */
+class ChunkBatchLoadEvent : public LevelEvent {
+public:
+    ENDSTONE_EVENT(ChunkBatchLoadEvent);
+
+    ChunkBatchLoadEvent(Level &level, std::vector<Chunk *> chunks) : LevelEvent(level), chunks_(std::move(chunks)) {}
+    ~ChunkBatchLoadEvent() override = default;
+
+    /**
+     * Gets the chunks loaded during the last tick
+     *
+     * Chunks that were loaded and discarded again within the same tick are not included.
+     *
+     * @return The chunks in the order they were loaded, which may span several dimensions
+     */
+    [[nodiscard]] const std::vector<Chunk *> &getChunks() const
+    {
+        return chunks_;
+    }
+
+private:
+    std::vector<Chunk *> chunks_;
+};
+
+}  // namespace endstone
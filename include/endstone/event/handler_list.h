@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <mutex>
 #include <string>
@@ -101,6 +102,17 @@ public:
         return baked_handlers_;
     }
 
+    /**
+     * Checks whether this handler list has no registered handlers
+     *
+     * @return true if no handlers are registered, false otherwise
+     */
+    [[nodiscard]] bool empty() const
+    {
+        std::lock_guard lock(mtx_);
+        return std::all_of(handlers_.begin(), handlers_.end(), [](const auto &pair) { return pair.second.empty(); });
+    }
+
 protected:
     void bake() const
     {
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "endstone/event/cancellable.h"
 #include "endstone/event/server/server_event.h"
 
@@ -64,6 +66,23 @@ public:
         payload_ = owned_payload_;
     }
 
+    /**
+     * @brief Gets the raw packet data **excluding** the header as a mutable buffer, for in-place edits that keep the
+     * payload length unchanged.
+     *
+     * @note The payload is copied into storage owned by this event on first use. The buffer is invalidated by
+     * setPayload.
+     *
+     * @return The packet payload data.
+     */
+    [[nodiscard]] std::span<char> getMutablePayload()
+    {
+        if (payload_.data() != owned_payload_.data()) {
+            setPayload(payload_);
+        }
+        return owned_payload_;
+    }
+
     /**
      * @brief Returns the player involved in this event
      *
@@ -0,0 +1,86 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+
+#include "endstone/block/block_data.h"
+#include "endstone/util/result.h"
+
+namespace endstone {
+
+/**
+ * @brief Summarises a committed BlockBatch.
+ */
+struct BlockBatchResult {
+    /**
+     * @brief The number of blocks that were changed.
+     *
+     * Changes whose chunk was unloaded between BlockBatch::setBlock and BlockBatch::commit are dropped and not counted.
+     */
+    std::size_t blocks_changed = 0;
+
+    /**
+     * @brief The number of packets sent to each player viewing the changes, one per sub-chunk changed.
+     */
+    std::size_t packets_sent = 0;
+
+    /**
+     * @brief The number of packets each viewing player did not receive compared to one packet per block.
+     */
+    std::size_t packets_saved = 0;
+};
+
+/**
+ * @brief Collects block changes in a dimension and applies them together.
+ *
+ * Nothing is changed until commit is called. Clients receive one packet per changed sub-chunk instead of one per
+ * block. A batch that is destroyed without being committed is discarded.
+ */
+class BlockBatch {
+public:
+    virtual ~BlockBatch() = default;
+
+    /**
+     * @brief Queues a block change, replacing any change queued earlier at the same position
+     *
+     * @param x X-coordinate of the block
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block
+     * @param block The new block
+     * @return An error if the position is outside the height range of the dimension or its chunk is not loaded
+     */
+    virtual Result<void> setBlock(int x, int y, int z, const BlockData &block) = 0;
+
+    /**
+     * @brief Gets the number of block changes queued
+     *
+     * @return Number of queued changes
+     */
+    [[nodiscard]] virtual std::size_t getSize() const = 0;
+
+    /**
+     * @brief Applies the queued changes and sends them to clients
+     *
+     * The batch is empty afterwards and can be reused.
+     *
+     * @param update_neighbors Whether the neighbours of the changed blocks are updated once every change has been
+     * applied, e.g. to let sand fall or redstone react
+     * @return A summary of the changes
+     */
+    virtual BlockBatchResult commit(bool update_neighbors = true) = 0;
+};
+
+}  // namespace endstone
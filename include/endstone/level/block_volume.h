@@ -0,0 +1,178 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace endstone {
+
+/**
+ * @brief Represents a cuboid of blocks, stored as a palette of block runtime IDs and one palette index per block.
+ *
+ * Blocks are ordered with the Y-coordinate varying fastest, then Z, then X, which matches the layout of blocks in
+ * a sub-chunk. Coordinates passed to this class are relative to the minimum corner of the cuboid.
+ */
+class BlockVolume {
+public:
+    BlockVolume(int size_x, int size_y, int size_z)
+        : size_x_(size_x), size_y_(size_y), size_z_(size_z), indices_(getVolume(), 0)
+    {
+    }
+
+    BlockVolume(int size_x, int size_y, int size_z, std::vector<std::uint32_t> palette,
+                std::vector<std::uint16_t> indices)
+        : size_x_(size_x), size_y_(size_y), size_z_(size_z), palette_(std::move(palette)), indices_(std::move(indices))
+    {
+    }
+
+    /**
+     * @brief Gets the number of blocks along the X-axis
+     *
+     * @return Size along the X-axis
+     */
+    [[nodiscard]] int getSizeX() const
+    {
+        return size_x_;
+    }
+
+    /**
+     * @brief Gets the number of blocks along the Y-axis
+     *
+     * @return Size along the Y-axis
+     */
+    [[nodiscard]] int getSizeY() const
+    {
+        return size_y_;
+    }
+
+    /**
+     * @brief Gets the number of blocks along the Z-axis
+     *
+     * @return Size along the Z-axis
+     */
+    [[nodiscard]] int getSizeZ() const
+    {
+        return size_z_;
+    }
+
+    /**
+     * @brief Gets the total number of blocks in this volume
+     *
+     * @return Number of blocks
+     */
+    [[nodiscard]] std::size_t getVolume() const
+    {
+        if (size_x_ <= 0 || size_y_ <= 0 || size_z_ <= 0) {
+            return 0;
+        }
+        return static_cast<std::size_t>(size_x_) * size_y_ * size_z_;
+    }
+
+    /**
+     * @brief Gets the position of a block in the index array
+     *
+     * @param x Relative X-coordinate of the block
+     * @param y Relative Y-coordinate of the block
+     * @param z Relative Z-coordinate of the block
+     * @return Position in the index array
+     */
+    [[nodiscard]] std::size_t getIndex(int x, int y, int z) const
+    {
+        return (static_cast<std::size_t>(x) * size_z_ + z) * size_y_ + y;
+    }
+
+    /**
+     * @brief Gets the palette of block runtime IDs, see BlockData::getRuntimeId
+     *
+     * @return The palette
+     */
+    [[nodiscard]] const std::vector<std::uint32_t> &getPalette() const
+    {
+        return palette_;
+    }
+
+    [[nodiscard]] std::vector<std::uint32_t> &getPalette()
+    {
+        return palette_;
+    }
+
+    /**
+     * @brief Gets the palette index of every block in this volume
+     *
+     * @return The palette indices
+     */
+    [[nodiscard]] const std::vector<std::uint16_t> &getIndices() const
+    {
+        return indices_;
+    }
+
+    [[nodiscard]] std::vector<std::uint16_t> &getIndices()
+    {
+        return indices_;
+    }
+
+    /**
+     * @brief Gets the runtime ID of the block at the given relative coordinates
+     *
+     * @param x Relative X-coordinate of the block
+     * @param y Relative Y-coordinate of the block
+     * @param z Relative Z-coordinate of the block
+     * @return Runtime ID of the block
+     */
+    [[nodiscard]] std::uint32_t getRuntimeId(int x, int y, int z) const
+    {
+        return palette_.at(indices_.at(getIndex(x, y, z)));
+    }
+
+private:
+    int size_x_;
+    int size_y_;
+    int size_z_;
+    std::vector<std::uint32_t> palette_;
+    std::vector<std::uint16_t> indices_;
+};
+
+/**
+ * @brief Controls how blocks are written in bulk.
+ */
+struct BlockWriteOptions {
+    /**
+     * @brief Whether neighbouring blocks are updated, e.g. to let sand fall or redstone react.
+     */
+    bool update_neighbors = true;
+
+    /**
+     * @brief Whether the changes are sent to clients.
+     */
+    bool update_clients = true;
+
+    /**
+     * @brief The maximum number of blocks written per tick, the rest are written on the following ticks.
+     *
+     * Zero writes every block at once.
+     */
+    std::size_t max_blocks_per_tick = 0;
+
+    /**
+     * @brief Called on the server thread once every block has been written.
+     */
+    std::function<void()> on_complete;
+};
+
+}  // namespace endstone
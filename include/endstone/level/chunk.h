@@ -15,6 +15,8 @@
 #pragma once
 
 #include "endstone/actor/actor.h"
+#include "endstone/level/chunk_snapshot.h"
+#include "endstone/util/result.h"
 
 namespace endstone {
 
@@ -52,6 +54,15 @@ public:
      * @return Parent Dimension
      */
     [[nodiscard]] virtual Dimension &getDimension() const = 0;
+
+    /**
+     * @brief Takes an immutable snapshot of the blocks and height map of this chunk
+     *
+     * This must be called on the server thread. The snapshot itself can be read from any thread.
+     *
+     * @return The snapshot, or an error if the chunk is no longer loaded
+     */
+    [[nodiscard]] virtual Result<ChunkSnapshot> getSnapshot() const = 0;
 };
 
 }  // namespace endstone
@@ -0,0 +1,175 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace endstone {
+
+/**
+ * @brief An immutable copy of the blocks and height map of a chunk.
+ *
+ * Snapshots are taken on the server thread with Chunk::getSnapshot and never change afterwards, so they can be read
+ * from any thread, e.g. from a task scheduled with Scheduler::runTaskAsync.
+ */
+class ChunkSnapshot {
+public:
+    static constexpr int SectionSize = 16;
+
+    /**
+     * @brief The blocks of one 16x16x16 section, stored as a palette of block runtime IDs and one palette index per
+     * block, ordered with Y varying fastest, then Z, then X.
+     *
+     * Sections holding a single block have an empty index array.
+     */
+    struct Section {
+        std::vector<std::uint32_t> palette;
+        std::vector<std::uint16_t> indices;
+    };
+
+    ChunkSnapshot(std::string dimension, int x, int z, int min_height, std::vector<Section> sections,
+                  std::array<int, SectionSize * SectionSize> height_map)
+        : dimension_(std::move(dimension)), x_(x), z_(z), min_height_(min_height), sections_(std::move(sections)),
+          height_map_(height_map)
+    {
+    }
+
+    /**
+     * @brief Gets the name of the dimension this snapshot was taken from
+     *
+     * @return Name of the dimension
+     */
+    [[nodiscard]] const std::string &getDimensionName() const
+    {
+        return dimension_;
+    }
+
+    /**
+     * @brief Gets the X-coordinate of the chunk
+     *
+     * @return X-coordinate
+     */
+    [[nodiscard]] int getX() const
+    {
+        return x_;
+    }
+
+    /**
+     * @brief Gets the Z-coordinate of the chunk
+     *
+     * @return Z-coordinate
+     */
+    [[nodiscard]] int getZ() const
+    {
+        return z_;
+    }
+
+    /**
+     * @brief Gets the lowest Y-coordinate in the snapshot
+     *
+     * @return Minimum height, inclusive
+     */
+    [[nodiscard]] int getMinHeight() const
+    {
+        return min_height_;
+    }
+
+    /**
+     * @brief Gets the Y-coordinate above the highest block in the snapshot
+     *
+     * @return Maximum height, exclusive
+     */
+    [[nodiscard]] int getMaxHeight() const
+    {
+        return min_height_ + static_cast<int>(sections_.size()) * SectionSize;
+    }
+
+    /**
+     * @brief Gets the sections of the chunk, from the bottom up
+     *
+     * @return The sections
+     */
+    [[nodiscard]] const std::vector<Section> &getSections() const
+    {
+        return sections_;
+    }
+
+    /**
+     * @brief Gets the runtime ID of the block at the given coordinates, see BlockData::getRuntimeId
+     *
+     * @param x X-coordinate of the block within the chunk, between 0 and 15
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block within the chunk, between 0 and 15
+     * @return Runtime ID of the block
+     * @throws std::out_of_range if the coordinates are outside of the snapshot
+     */
+    [[nodiscard]] std::uint32_t getRuntimeId(int x, int y, int z) const
+    {
+        if (!contains(x, y, z)) {
+            throw std::out_of_range("Coordinates are outside of the chunk snapshot");
+        }
+        const auto &section = sections_[(y - min_height_) / SectionSize];
+        if (section.indices.empty()) {
+            return section.palette.front();
+        }
+        const auto local_y = (y - min_height_) % SectionSize;
+        return section.palette[section.indices[(x * SectionSize + z) * SectionSize + local_y]];
+    }
+
+    /**
+     * @brief Gets the Y-coordinate of the highest non-air block at the given coordinates
+     *
+     * @param x X-coordinate of the block within the chunk, between 0 and 15
+     * @param z Z-coordinate of the block within the chunk, between 0 and 15
+     * @return Y-coordinate of the highest block, or one below the minimum height if the column is empty
+     * @throws std::out_of_range if the coordinates are outside of the chunk
+     */
+    [[nodiscard]] int getHighestBlockYAt(int x, int z) const
+    {
+        if (x < 0 || x >= SectionSize || z < 0 || z >= SectionSize) {
+            throw std::out_of_range("Coordinates are outside of the chunk snapshot");
+        }
+        return height_map_[x * SectionSize + z];
+    }
+
+    /**
+     * @brief Checks if the given coordinates are inside this snapshot
+     *
+     * @param x X-coordinate of the block within the chunk
+     * @param y Y-coordinate of the block
+     * @param z Z-coordinate of the block within the chunk
+     * @return true if the coordinates are inside this snapshot
+     */
+    [[nodiscard]] bool contains(int x, int y, int z) const
+    {
+        return x >= 0 && x < SectionSize && z >= 0 && z < SectionSize && y >= min_height_ && y < getMaxHeight();
+    }
+
+private:
+    std::string dimension_;
+    int x_;
+    int z_;
+    int min_height_;
+    std::vector<Section> sections_;
+    std::array<int, SectionSize * SectionSize> height_map_;
+};
+
+}  // namespace endstone
@@ -14,12 +14,23 @@
 
 #pragma once
 
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "endstone/actor/actor_columns.h"
 #include "endstone/block/block.h"
+#include "endstone/block/block_data.h"
+#include "endstone/level/block_batch.h"
+#include "endstone/level/block_volume.h"
 #include "endstone/level/chunk.h"
 #include "endstone/util/result.h"
 
 namespace endstone {
 
+class Plugin;
+
 /**
  * @brief Represents a dimension within a Level.
  */
@@ -76,6 +87,74 @@ public:
      */
     [[nodiscard]] virtual std::unique_ptr<Block> getBlockAt(Location location) const = 0;
 
+    /**
+     * @brief Reads the blocks in a cuboid.
+     *
+     * @param x1 X-coordinate of the first corner
+     * @param y1 Y-coordinate of the first corner
+     * @param z1 Z-coordinate of the first corner
+     * @param x2 X-coordinate of the opposite corner, inclusive
+     * @param y2 Y-coordinate of the opposite corner, inclusive
+     * @param z2 Z-coordinate of the opposite corner, inclusive
+     * @return The blocks in the cuboid, starting at its minimum corner, or an error if any chunk it overlaps is
+     * not loaded
+     */
+    [[nodiscard]] virtual Result<BlockVolume> getBlocks(int x1, int y1, int z1, int x2, int y2, int z2) const = 0;
+
+    /**
+     * @brief Writes the blocks of a volume into this dimension.
+     *
+     * Each palette entry is resolved once. If the write is split across ticks, or earlier writes are still
+     * pending, the blocks are written on the following ticks in the order the writes were made. Blocks in chunks
+     * that have been unloaded by the time they are written are skipped. Pending writes are cancelled when the
+     * plugin is disabled.
+     *
+     * @param plugin The plugin making the write
+     * @param x X-coordinate of the minimum corner to write to
+     * @param y Y-coordinate of the minimum corner to write to
+     * @param z Z-coordinate of the minimum corner to write to
+     * @param volume The blocks to write
+     * @param options Options for the write
+     * @return An error if the volume is invalid, out of bounds or overlaps a chunk that is not loaded
+     */
+    virtual Result<void> setBlocks(Plugin &plugin, int x, int y, int z, BlockVolume volume,
+                                   BlockWriteOptions options) = 0;
+
+    /**
+     * @brief Fills a cuboid with a single block.
+     *
+     * The write is made in the same way as setBlocks.
+     *
+     * @param plugin The plugin making the write
+     * @param x1 X-coordinate of the first corner
+     * @param y1 Y-coordinate of the first corner
+     * @param z1 Z-coordinate of the first corner
+     * @param x2 X-coordinate of the opposite corner, inclusive
+     * @param y2 Y-coordinate of the opposite corner, inclusive
+     * @param z2 Z-coordinate of the opposite corner, inclusive
+     * @param block The block to fill the cuboid with
+     * @param options Options for the write
+     * @return An error if the cuboid is out of bounds or overlaps a chunk that is not loaded
+     */
+    virtual Result<void> fill(Plugin &plugin, int x1, int y1, int z1, int x2, int y2, int z2, const BlockData &block,
+                              BlockWriteOptions options) = 0;
+
+    /**
+     * @brief Cancels the pending block writes made by a plugin.
+     *
+     * The blocks already written are kept and the completion callbacks of the cancelled writes are not called.
+     *
+     * @param plugin The plugin whose writes to cancel
+     */
+    virtual void cancelBlockWrites(Plugin &plugin) = 0;
+
+    /**
+     * @brief Starts collecting block changes to be applied together.
+     *
+     * @return A new, empty batch of block changes for this dimension
+     */
+    [[nodiscard]] virtual std::unique_ptr<BlockBatch> beginBlockBatch() = 0;
+
     /**
      * @brief Gets the highest non-empty (impassable) coordinate at the given coordinates.
      *
@@ -85,6 +164,18 @@ public:
      */
     [[nodiscard]] virtual int getHighestBlockYAt(int x, int z) const = 0;
 
+    /**
+     * @brief Gets the highest non-empty (impassable) coordinates of many columns at once.
+     *
+     * Columns that appear more than once are only scanned once.
+     *
+     * @param xs X-coordinates of the columns
+     * @param zs Z-coordinates of the columns, of the same length as xs
+     * @return Y-coordinate of the highest non-empty block of each column
+     */
+    [[nodiscard]] virtual Result<std::vector<int>> getHighestBlockYAt(const std::vector<int> &xs,
+                                                                      const std::vector<int> &zs) const = 0;
+
     /**
      * @brief Gets the highest non-empty (impassable) block at the given coordinates.
      *
@@ -108,6 +199,67 @@ public:
      * @return All loaded chunks
      */
     [[nodiscard]] virtual std::vector<std::unique_ptr<Chunk>> getLoadedChunks() = 0;
+
+    /**
+     * @brief Calls a function with the coordinates of each loaded chunk.
+     *
+     * Unlike getLoadedChunks, no Chunk objects are created, so this stays cheap with many chunks loaded. The visitor
+     * must not load or unload chunks, e.g. by getting a block in a chunk that is not loaded, as that invalidates the
+     * iteration.
+     *
+     * @param visitor Function called with the X and Z coordinates of each chunk, returning false stops the iteration
+     */
+    virtual void forEachLoadedChunk(const std::function<bool(int x, int z)> &visitor) const = 0;
+
+    /**
+     * @brief Gets the number of loaded chunks
+     *
+     * @return Number of loaded chunks
+     */
+    [[nodiscard]] virtual int getLoadedChunkCount() const = 0;
+
+    /**
+     * @brief Gets the actors within a given distance of a position.
+     *
+     * Only the chunks around the position are searched, so the cost depends on the size of the area rather than on
+     * the number of actors in the level.
+     *
+     * @param center Center of the search
+     * @param radius Maximum distance between the center and the position of an actor
+     * @param type Type of the actors to return, e.g. minecraft:zombie, or std::nullopt for all types
+     * @return The actors found
+     */
+    [[nodiscard]] virtual std::vector<Actor *> getNearbyActors(Vector<float> center, float radius,
+                                                               std::optional<std::string> type) const = 0;
+
+    /**
+     * @brief Gets the actors whose bounding box intersects a box.
+     *
+     * @param min Minimum corner of the box
+     * @param max Maximum corner of the box
+     * @param type Type of the actors to return, e.g. minecraft:zombie, or std::nullopt for all types
+     * @return The actors found
+     */
+    [[nodiscard]] virtual std::vector<Actor *> getNearbyActors(Vector<float> min, Vector<float> max,
+                                                               std::optional<std::string> type) const = 0;
+
+    /**
+     * @brief Gets the state of every actor in this dimension in a single pass.
+     *
+     * This is much cheaper than querying each actor separately when processing many actors at once.
+     *
+     * @return The state of the actors, one array per property
+     */
+    [[nodiscard]] virtual ActorColumns getActorColumns() const = 0;
+
+    /**
+     * @brief Gets the state of the actors whose bounding box intersects a box in a single pass.
+     *
+     * @param min Minimum corner of the box
+     * @param max Maximum corner of the box
+     * @return The state of the actors, one array per property
+     */
+    [[nodiscard]] virtual ActorColumns getActorColumns(Vector<float> min, Vector<float> max) const = 0;
 };
 }  // namespace endstone
 
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <variant>
 
 #include "endstone/actor/mob.h"
@@ -383,6 +384,20 @@ public:
      */
     [[nodiscard]] virtual std::chrono::milliseconds getPing() const = 0;
 
+    /**
+     * @brief Gets the number of packets from this player that have been dropped by the packet rate limiter.
+     *
+     * @return the number of dropped packets
+     */
+    [[nodiscard]] virtual std::uint64_t getDroppedPacketCount() const = 0;
+
+    /**
+     * @brief Gets the total size of the packets from this player that have been dropped by the packet rate limiter.
+     *
+     * @return the size of dropped packets in bytes
+     */
+    [[nodiscard]] virtual std::uint64_t getDroppedPacketBytes() const = 0;
+
     /**
      * @brief Gets the player's current locale.
      *
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <filesystem>
 #include <regex>
 #include <string>
@@ -69,23 +70,32 @@ public:
             return {};
         }
 
-        std::vector<Plugin *> loaded_plugins;
+        std::vector<std::regex> filters;
+        for (const auto &pattern : getPluginFileFilters()) {
+            filters.emplace_back(pattern);
+        }
 
+        std::vector<std::string> files;
         for (const auto &entry : std::filesystem::directory_iterator(dir)) {
             if (!is_regular_file(entry.status())) {
                 continue;
             }
 
-            const auto &file = entry.path();
-            for (const auto &pattern : getPluginFileFilters()) {
-                if (std::regex r(pattern); std::regex_search(file.string(), r)) {
-                    if (auto *plugin = loadPlugin(file.string())) {
-                        loaded_plugins.push_back(plugin);
-                    }
-                }
+            auto file = entry.path().string();
+            if (std::ranges::any_of(filters, [&](const auto &filter) { return std::regex_search(file, filter); })) {
+                files.push_back(std::move(file));
             }
         }
 
+        // Load in a stable order, the directory iteration order depends on the file system
+        std::ranges::sort(files);
+
+        std::vector<Plugin *> loaded_plugins;
+        for (const auto &file : files) {
+            if (auto *plugin = loadPlugin(file)) {
+                loaded_plugins.push_back(plugin);
+            }
+        }
         return loaded_plugins;
     }
 
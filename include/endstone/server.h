@@ -15,6 +15,7 @@
 #pragma once
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -40,8 +41,10 @@ class Enchantment;
 class ItemFactory;
 class ItemType;
 class Scheduler;
+class Plugin;
 class PluginCommand;
 class PluginManager;
+class ServerListPingEvent;
 
 template <typename T>
 class Registry;
@@ -398,6 +401,35 @@ public:
       */
     [[nodiscard]] virtual Registry<ItemType> &getItemRegistry() const = 0;
 
+    /**
+     * @brief Sets an override for the server list ping responses sent to the given host.
+     *
+     * Unlike ServerListPingEvent, which is called for every ping, the override is only called when the cached ping
+     * response is rebuilt, i.e. when the number of players or the message of the day changes. Overrides for a specific
+     * host are applied after the one for all hosts. The override is removed when the plugin is disabled.
+     *
+     * @param plugin the plugin that owns the override
+     * @param host the host the override applies to, or an empty string to apply it to all hosts
+     * @param override the function that modifies the ping response
+     */
+    virtual void setServerListPingOverride(Plugin &plugin, std::string host,
+                                           std::function<void(ServerListPingEvent &)> override) = 0;
+
+    /**
+     * @brief Removes the override for the server list ping responses sent to the given host.
+     *
+     * @param plugin the plugin that owns the override
+     * @param host the host, or an empty string to remove the override for all hosts
+     */
+    virtual void removeServerListPingOverride(Plugin &plugin, std::string host) = 0;
+
+    /**
+     * @brief Removes all the server list ping overrides set by the given plugin.
+     *
+     * @param plugin the plugin that owns the overrides
+     */
+    virtual void removeServerListPingOverrides(Plugin &plugin) = 0;
+
     /**
      * @brief Used for all administrative messages, such as an operator using a command.
      */
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <variant>
 
 #include "bedrock/platform/uuid.h"
@@ -38,6 +40,19 @@ static_assert(sizeof(NetworkID) == 16);
 
 struct NetworkID : private std::variant<std::monostate, P2P::NetworkID, Realms::NetworkID> {
     std::strong_ordering operator<=>(const NetworkID &) const = default;
+
+    [[nodiscard]] std::size_t getHash() const  // Endstone
+    {
+        const auto &id = static_cast<const variant &>(*this);
+        constexpr std::hash<std::uint64_t> hash;
+        if (const auto *p2p = std::get_if<P2P::NetworkID>(&id)) {
+            return hash(p2p->value);
+        }
+        if (const auto *realms = std::get_if<Realms::NetworkID>(&id)) {
+            return hash(realms->value.data[0]) ^ (hash(realms->value.data[1]) << 1);
+        }
+        return 0;
+    }
 };
 static_assert(sizeof(NetworkID) == 24);
 }  // namespace NetherNet
@@ -16,6 +16,8 @@
 
 #include <string>
 
+#include <boost/functional/hash.hpp>
+
 std::string NetworkIdentifier::getAddress() const
 {
     char buffer[INET6_ADDRSTRLEN + 1] = {};
@@ -75,3 +77,29 @@ bool NetworkIdentifier::equalsTypeData(const NetworkIdentifier &other) const
         return false;
     }
 }
+
+std::size_t NetworkIdentifier::getHash() const
+{
+    // Must stay consistent with equalsTypeData: only hash the fields that take part in the comparison.
+    std::size_t seed = 0;
+    boost::hash_combine(seed, static_cast<std::uint32_t>(type));
+    switch (type) {
+    case Type::RakNet:
+        boost::hash_combine(seed, guid.g);
+        break;
+    case Type::Address:
+        boost::hash_combine(seed, sock.addr4.sin_port);
+        boost::hash_combine(seed, sock.addr4.sin_addr.s_addr);
+        break;
+    case Type::Address6:
+        boost::hash_combine(seed, sock.addr6.sin6_port);
+        boost::hash_range(seed, std::begin(sock.addr6.sin6_addr.s6_addr), std::end(sock.addr6.sin6_addr.s6_addr));
+        break;
+    case Type::NetherNet:
+        boost::hash_combine(seed, nether_net_id.getHash());
+        break;
+    default:
+        break;
+    }
+    return seed;
+}
@@ -47,9 +47,20 @@ public:
     bool operator==(const NetworkIdentifier &other) const;
     bool operator!=(const NetworkIdentifier &other) const;
     [[nodiscard]] bool equalsTypeData(const NetworkIdentifier &other) const;
+    [[nodiscard]] std::size_t getHash() const;
 };
 static_assert(sizeof(NetworkIdentifier) == 176);
 
+namespace std {
+template <>
+struct hash<NetworkIdentifier> {  // NOLINT
+    std::size_t operator()(const NetworkIdentifier &value) const noexcept
+    {
+        return value.getHash();
+    }
+};
+}  // namespace std
+
 struct NetworkIdentifierWithSubId {
     NetworkIdentifier id;
     SubClientId sub_client_id;
@@ -25,6 +25,10 @@
 #include "bedrock/network/raknet_connector.h"
 #include "bedrock/platform/threading/mutex_details.h"
 
+namespace endstone {
+class SocketAddress;  // Endstone
+}
+
 class NetworkSystem : public RakNetConnector::ConnectionCallbacks,
                       public RakPeerHelper::IPSupportInterface,
                       public NetworkEnableDisableListener {
@@ -46,8 +50,20 @@ protected:
 public:
     NetworkConnection *_getConnectionFromId(const NetworkIdentifier &) const;  // Endstone: private -> public
 
+    // Endstone begins
+    ENDSTONE_VHOOK bool onNewIncomingConnectionHook(const NetworkIdentifier &id, std::shared_ptr<NetworkPeer> &&peer);
+    ENDSTONE_VHOOK void onConnectionClosedHook(const NetworkIdentifier &id, Connection::DisconnectFailReason reason,
+                                               const std::string &message, bool skip_message);
+    ENDSTONE_VHOOK void onAllConnectionsClosedHook(Connection::DisconnectFailReason reason,
+                                                   const std::string &message, bool skip_message);
+    ENDSTONE_VHOOK void onAllRemoteConnectionsClosedHook(Connection::DisconnectFailReason reason,
+                                                         const std::string &message, bool skip_message);
+    [[nodiscard]] const endstone::SocketAddress *getSocketAddress(const NetworkIdentifier &id) const;
+    // Endstone ends
+
 private:
     void _sendInternal(const NetworkIdentifier &id, const Packet &packet, const std::string &data);
+    void _sendInternal(NetworkConnection &connection, const Packet &packet, const std::string &data);  // Endstone
     std::unique_ptr<RemoteConnector> remote_connector_;
     std::unique_ptr<ServerLocator> server_locator_;
     Bedrock::Threading::RecursiveMutex connections_mutex_;
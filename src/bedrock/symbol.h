@@ -16,7 +16,11 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string_view>
 #include <utility>
@@ -40,6 +44,58 @@ consteval std::size_t get_symbol(const std::string_view symbol)
     throw "symbol not found";
 }
 
+namespace symbol_index {
+constexpr std::uint64_t hash(std::string_view str, std::uint64_t seed)
+{
+    std::uint64_t h = 14695981039346656037ULL ^ (seed * 0x9E3779B97F4A7C15ULL);  // FNV-1a
+    for (const auto c : str) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Quadratic table size keeps the expected number of seeds to try below two.
+constexpr std::size_t table_size = std::bit_ceil(std::max<std::size_t>(symbols.size() * symbols.size(), 1));
+static_assert(symbols.size() < std::numeric_limits<std::uint16_t>::max());
+
+struct PerfectHash {
+    std::uint64_t seed;
+    std::array<std::uint16_t, table_size> slots;  // index into symbols plus one, zero for an empty slot
+};
+
+consteval PerfectHash build()
+{
+    for (std::uint64_t seed = 0;; ++seed) {
+        PerfectHash result{seed, {}};
+        bool collision = false;
+        for (std::size_t i = 0; i < symbols.size() && !collision; ++i) {
+            auto &slot = result.slots[hash(symbols[i].first, seed) & (table_size - 1)];
+            collision = slot != 0;
+            slot = static_cast<std::uint16_t>(i + 1);
+        }
+        if (!collision) {
+            return result;
+        }
+    }
+}
+
+inline constexpr PerfectHash perfect_hash = build();
+}  // namespace symbol_index
+
+/**
+ * @brief Looks up the offset of a symbol at runtime in constant time.
+ */
+constexpr std::optional<std::size_t> find_symbol(const std::string_view symbol)
+{
+    using namespace symbol_index;
+    const auto slot = perfect_hash.slots[hash(symbol, perfect_hash.seed) & (table_size - 1)];
+    if (slot == 0 || symbols[slot - 1].first != symbol) {
+        return std::nullopt;
+    }
+    return symbols[slot - 1].second;
+}
+
 template <typename Func>
 constexpr void foreach_symbol(Func &&func)
 {
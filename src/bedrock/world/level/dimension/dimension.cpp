@@ -29,6 +29,11 @@ const std::string &Dimension::getName() const
     return name_;
 }
 
+DimensionType Dimension::getId() const
+{
+    return id_;
+}
+
 BlockSource &Dimension::getBlockSourceFromMainChunkSource() const
 {
     return *block_source_;
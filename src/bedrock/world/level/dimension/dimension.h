@@ -64,6 +64,7 @@ public:
     BlockSource &getBlockSourceFromMainChunkSource() const;
 
     [[nodiscard]] const std::string &getName() const;                 // Endstone
+    [[nodiscard]] DimensionType getId() const;                        // Endstone
     [[nodiscard]] endstone::Dimension &getEndstoneDimension() const;  // Endstone
 
 private:
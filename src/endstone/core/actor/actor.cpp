@@ -108,28 +108,15 @@ std::uint64_t EndstoneActor::getRuntimeId() const
 
 Location EndstoneActor::getLocation() const
 {
-    auto [x, y, z] = getActor().getPosition();
-    y -= ActorOffset::getHeightOffset(getActor().getEntity());
+    const auto [x, y, z] = getFeetPosition(getActor());
     const auto &[pitch, yaw] = getActor().getRotation();
     return {&getDimension(), x, y, z, pitch, yaw};
 }
 
 Vector<float> EndstoneActor::getVelocity() const
 {
-    if (getActor().hasCategory(ActorCategory::Mob) || getActor().hasCategory(ActorCategory::Ridable)) {
-        auto *actor = getActor().getVehicle();
-        if (!actor) {
-            actor = &getActor();
-        }
-        auto *component = actor->tryGetComponent<PostTickPositionDeltaComponent>();
-        if (component) {
-            const auto &delta = component->value;
-            return {delta.x, delta.y, delta.z};
-        }
-    }
-
-    const auto &delta = getActor().getPosDelta();
-    return {delta.x, delta.y, delta.z};
+    const auto [x, y, z] = getPositionDelta(getActor());
+    return {x, y, z};
 }
 
 bool EndstoneActor::isOnGround() const
@@ -154,7 +141,7 @@ Level &EndstoneActor::getLevel() const
 
 Dimension &EndstoneActor::getDimension() const
 {
-    return *getLevel().getDimension(getActor().getDimension().getName());
+    return getActor().getDimension().getEndstoneDimension();
 }
 
 void EndstoneActor::setRotation(float yaw, float pitch)
@@ -286,6 +273,15 @@ void EndstoneActor::setScoreTag(std::string score)
     getActor().setScoreTag(score);
 }
 
+std::vector<Actor *> EndstoneActor::getNearbyActors(float x, float y, float z) const
+{
+    const auto &actor = getActor();
+    const auto &aabb = actor.getAABB();
+    const Vec3 extent{x, y, z};
+    auto &dimension = static_cast<EndstoneDimension &>(actor.getDimension().getEndstoneDimension());
+    return dimension.fetchActors({aabb.min - extent, aabb.max + extent}, &actor, nullptr);
+}
+
 PermissibleBase &EndstoneActor::getPermissibleBase()
 {
     static std::shared_ptr<PermissibleBase> perm = PermissibleBase::create(nullptr);
@@ -297,6 +293,27 @@ PermissibleBase &EndstoneActor::getPermissibleBase()
     return getHandle<::Actor>();
 }
 
+Vec3 EndstoneActor::getFeetPosition(const ::Actor &actor)
+{
+    auto position = actor.getPosition();
+    position.y -= ActorOffset::getHeightOffset(actor.getEntity());
+    return position;
+}
+
+Vec3 EndstoneActor::getPositionDelta(const ::Actor &actor)
+{
+    if (actor.hasCategory(ActorCategory::Mob) || actor.hasCategory(ActorCategory::Ridable)) {
+        const auto *vehicle = actor.getVehicle();
+        if (!vehicle) {
+            vehicle = &actor;
+        }
+        if (const auto *component = vehicle->tryGetComponent<PostTickPositionDeltaComponent>(); component) {
+            return component->value;
+        }
+    }
+    return actor.getPosDelta();
+}
+
 std::shared_ptr<EndstoneActor> EndstoneActor::create(EndstoneServer &server, ::Actor &actor)
 {
     return PermissibleFactory::create<EndstoneActor>(server, actor);
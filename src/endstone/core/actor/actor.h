@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "bedrock/core/math/vec3.h"
 #include "bedrock/entity/weak_entity_ref.h"
 #include "endstone/actor/actor.h"
 #include "endstone/core/permissions/permissible_base.h"
@@ -84,11 +85,16 @@ public:
     void setNameTag(std::string name) override;
     [[nodiscard]] std::string getScoreTag() const override;
     void setScoreTag(std::string score) override;
+    [[nodiscard]] std::vector<Actor *> getNearbyActors(float x, float y, float z) const override;
 
     ::Actor &getActor() const;
 
     static std::shared_ptr<EndstoneActor> create(EndstoneServer &server, ::Actor &actor);
 
+    // Shared with the bulk queries that read actors without going through their wrappers
+    [[nodiscard]] static Vec3 getFeetPosition(const ::Actor &actor);
+    [[nodiscard]] static Vec3 getPositionDelta(const ::Actor &actor);
+
 protected:
     template <typename T>
     T &getHandle() const
@@ -247,6 +247,11 @@ void EndstoneMob::setScoreTag(std::string score)
     EndstoneActor::setScoreTag(score);
 }
 
+std::vector<Actor *> EndstoneMob::getNearbyActors(float x, float y, float z) const
+{
+    return EndstoneActor::getNearbyActors(x, y, z);
+}
+
 bool EndstoneMob::isGliding() const
 {
     return getMob().isGliding();
@@ -75,6 +75,7 @@ public:
     void setNameTag(std::string name) override;
     [[nodiscard]] std::string getScoreTag() const override;
     void setScoreTag(std::string score) override;
+    [[nodiscard]] std::vector<Actor *> getNearbyActors(float x, float y, float z) const override;
 
     // Mob
     [[nodiscard]] bool isGliding() const override;
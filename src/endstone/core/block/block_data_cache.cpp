@@ -0,0 +1,72 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/block/block_data_cache.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace endstone::core {
+
+std::string BlockDataCache::makeKey(std::string_view type, const BlockStates &block_states)
+{
+    std::vector<const BlockStates::value_type *> states;
+    states.reserve(block_states.size());
+    for (const auto &state : block_states) {
+        states.push_back(&state);
+    }
+    std::ranges::sort(states, {}, [](const auto *state) { return std::string_view(state->first); });
+
+    // Fields are separated by NUL and values are tagged with their type, so "1", 1 and true never collide
+    std::string key(type);
+    for (const auto *state : states) {
+        key += '\0';
+        key += state->first;
+        key += '\0';
+        std::visit(
+            [&key](const auto &value) {
+                using T = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<T, bool>) {
+                    key += value ? "b1" : "b0";
+                }
+                else if constexpr (std::is_same_v<T, int>) {
+                    key += 'i';
+                    key += std::to_string(value);
+                }
+                else {
+                    key += 's';
+                    key += value;
+                }
+            },
+            state->second);
+    }
+    return key;
+}
+
+void BlockDataCache::clear()
+{
+    std::unique_lock lock(mutex_);
+    blocks_.clear();
+}
+
+BlockDataCache::Stats BlockDataCache::getStats() const
+{
+    std::shared_lock lock(mutex_);
+    return {blocks_.size(), hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed)};
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,89 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "endstone/block/block_data.h"
+
+class Block;
+
+namespace endstone::core {
+
+/**
+ * @brief Interns the blocks resolved from a type and a set of block states.
+ *
+ * Resolving a block descriptor is expensive and the set of block permutations is finite, so every permutation
+ * requested by plugins is resolved once and looked up by its canonical key afterwards. Unknown types are not cached.
+ * The cache must be cleared whenever the block registry is reloaded.
+ */
+class BlockDataCache {
+public:
+    struct Stats {
+        std::size_t size;
+        std::uint64_t hits;
+        std::uint64_t misses;
+    };
+
+    /**
+     * @brief Builds a key that does not depend on the order of the block states.
+     */
+    [[nodiscard]] static std::string makeKey(std::string_view type, const BlockStates &block_states);
+
+    /**
+     * @brief Gets the block cached for the given key, resolving and caching it on a miss.
+     *
+     * @param key the key built with makeKey
+     * @param resolve called on a miss, returns the block or nullptr if it cannot be found
+     * @return the block, or nullptr if it cannot be found
+     */
+    template <typename Resolver>
+    const ::Block *get(const std::string &key, Resolver &&resolve)
+    {
+        {
+            std::shared_lock lock(mutex_);
+            if (const auto it = blocks_.find(key); it != blocks_.end()) {
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return it->second;
+            }
+        }
+
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        const ::Block *block = resolve();
+        if (block) {
+            std::unique_lock lock(mutex_);
+            blocks_.emplace(key, block);
+        }
+        return block;
+    }
+
+    void clear();
+    [[nodiscard]] Stats getStats() const;
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, const ::Block *> blocks_;
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> misses_{0};
+};
+
+}  // namespace endstone::core
@@ -14,9 +14,11 @@
 
 #include "endstone/core/block/block_state.h"
 
-#include "bedrock/world/level/block/block_descriptor.h"
+#include <entt/entt.hpp>
+
 #include "endstone/core/block/block.h"
 #include "endstone/core/block/block_data.h"
+#include "endstone/core/server.h"
 
 namespace endstone::core {
 
@@ -45,11 +47,10 @@ std::string EndstoneBlockState::getType() const
 Result<void> EndstoneBlockState::setType(std::string type)
 {
     if (getType() != type) {
-        using ScriptModuleMinecraft::ScriptBlockUtils::createBlockDescriptor;
-        const auto block_descriptor = createBlockDescriptor(type, std::nullopt);
-        auto *block = const_cast<::Block *>(block_descriptor.tryGetBlockNoLogging());
-        ENDSTONE_CHECKF(block, "BlockState::setType failed: unknown block type {}.", type);
-        block_ = block;
+        const auto &server = entt::locator<EndstoneServer>::value();
+        auto result = server.resolveBlock(type, {});
+        ENDSTONE_CHECKF(result, "BlockState::setType failed: unknown block type {}.", type);
+        block_ = const_cast<::Block *>(result.value());
     }
     return {};
 }
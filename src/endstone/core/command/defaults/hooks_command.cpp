@@ -0,0 +1,99 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/command/defaults/hooks_command.h"
+
+#include <algorithm>
+#include <string>
+
+#include "endstone/color_format.h"
+#include "endstone/core/util/hook_stats.h"
+
+namespace endstone::core {
+
+namespace {
+constexpr std::size_t MaxEntries = 20;
+}
+
+HooksCommand::HooksCommand() : EndstoneCommand("hooks")
+{
+    setDescription("Shows how often the hooked server functions have been called and how long they take.");
+    setUsages("/hooks (reset|stop)[action: HooksAction]", "/hooks (start)<action: HooksStartAction> [interval: int]");
+    setPermissions("endstone.command.hooks");
+}
+
+bool HooksCommand::execute(CommandSender &sender, const std::vector<std::string> &args) const
+{
+    if (!testPermission(sender)) {
+        return true;
+    }
+
+    if (!args.empty() && args[0] == "reset") {
+        HookStats::reset();
+        sender.sendMessage("Hook counters have been reset.");
+        return true;
+    }
+
+    if (!args.empty() && args[0] == "start") {
+        int interval = 1;
+        if (args.size() > 1) {
+            try {
+                interval = std::stoi(args[1]);
+            }
+            catch (const std::exception &) {
+                interval = 0;
+            }
+            if (interval < 1) {
+                sender.sendErrorMessage("Sample interval must be a positive integer.");
+                return true;
+            }
+        }
+        HookProfiler::enable(interval);
+        sender.sendMessage("Hook profiling started, timing 1 in {} calls.", interval);
+        return true;
+    }
+
+    if (!args.empty() && args[0] == "stop") {
+        HookProfiler::disable();
+        sender.sendMessage("Hook profiling stopped.");
+        return true;
+    }
+
+    const auto entries = HookStats::getEntries();
+    sender.sendMessage("{}---- {}Hook calls{} ----", ColorFormat::Green, ColorFormat::Reset, ColorFormat::Green);
+    if (entries.empty()) {
+        sender.sendMessage("{}No hooks have been called.", ColorFormat::Gold);
+        return true;
+    }
+
+    for (std::size_t i = 0; i < std::min(entries.size(), MaxEntries); ++i) {
+        const auto &entry = entries[i];
+        const auto &profile = entry.profile;
+        if (profile.samples == 0) {
+            sender.sendMessage("{}{}: {}{}", ColorFormat::Gold, entry.name, ColorFormat::Red, entry.calls);
+            continue;
+        }
+        sender.sendMessage("{}{}: {}{}{} calls, original {}{:.2f}us{}, dispatch {}{:.2f}us{} ({} samples)",
+                           ColorFormat::Gold, entry.name, ColorFormat::Red, entry.calls, ColorFormat::Gold,
+                           ColorFormat::Red, profile.original_ns / 1000.0 / profile.samples, ColorFormat::Gold,
+                           ColorFormat::Red, profile.dispatch_ns / 1000.0 / profile.samples, ColorFormat::Gold,
+                           profile.samples);
+    }
+    if (entries.size() > MaxEntries) {
+        sender.sendMessage("{}... and {} more", ColorFormat::Gray, entries.size() - MaxEntries);
+    }
+    return true;
+}
+
+}  // namespace endstone::core
@@ -78,6 +78,12 @@ bool StatusCommand::execute(CommandSender &sender, const std::vector<std::string
     sender.sendMessage("{}Total memory: {}{:.2f} MB", ColorFormat::Gold, ColorFormat::Red,
                        detail::get_total_virtual_memory() / 1024.0F / 1024.0F);
 
+    const auto cache = server.getBlockDataCache().getStats();
+    const auto lookups = cache.hits + cache.misses;
+    sender.sendMessage("{}Block data cache: {}{} entries, {} hits, {} misses ({:.2f}%)", ColorFormat::Gold,
+                       ColorFormat::Red, cache.size, cache.hits, cache.misses,
+                       lookups == 0 ? 0.0 : cache.hits * 100.0 / lookups);
+
     auto *level = server.getLevel();
     sender.sendMessage("{}Level \"{}\":", ColorFormat::Gold, level->getName());
     auto actors = server.getLevel()->getActors();
@@ -90,7 +96,7 @@ bool StatusCommand::execute(CommandSender &sender, const std::vector<std::string
         }
         sender.sendMessage("- {}Dimension \"{}\": {}{}{} loaded chunks, {}{}{} entities",              //
                            ColorFormat::Gold, dimension->getName(),                                    //
-                           ColorFormat::Red, dimension->getLoadedChunks().size(), ColorFormat::Green,  //
+                           ColorFormat::Red, dimension->getLoadedChunkCount(), ColorFormat::Green,     //
                            ColorFormat::Red, actor_count, ColorFormat::Green);
     }
 
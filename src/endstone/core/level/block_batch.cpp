@@ -0,0 +1,102 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/level/block_batch.h"
+
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "bedrock/core/utility/binary_stream.h"
+#include "bedrock/world/level/block/block_legacy.h"
+#include "endstone/core/block/block_data.h"
+#include "endstone/core/level/dimension.h"
+#include "endstone/core/network/data_packet.h"
+
+namespace endstone::core {
+
+EndstoneBlockBatch::EndstoneBlockBatch(EndstoneDimension &dimension) : dimension_(dimension) {}
+
+Result<void> EndstoneBlockBatch::setBlock(int x, int y, int z, const BlockData &block)
+{
+    ENDSTONE_CHECK_RESULT(dimension_.checkBounds(y, y));
+    ENDSTONE_CHECK_RESULT(dimension_.checkLoaded(x, z, x, z));
+    changes_.insert_or_assign(BlockPos(x, y, z), &static_cast<const EndstoneBlockData &>(block).getHandle());
+    return {};
+}
+
+std::size_t EndstoneBlockBatch::getSize() const
+{
+    return changes_.size();
+}
+
+BlockBatchResult EndstoneBlockBatch::commit(bool update_neighbors)
+{
+    // Group the changes by sub-chunk, each group is sent to clients as a single packet
+    using SubChunkPos = std::tuple<int, int, int>;
+    std::map<SubChunkPos, std::vector<std::pair<BlockPos, const ::Block *>>> sub_chunks;
+
+    auto &block_source = dimension_.getHandle().getBlockSourceFromMainChunkSource();
+    BlockBatchResult result;
+    for (const auto &[pos, block] : changes_) {
+        // Neither neighbours nor clients are updated here, both happen below once every change is in place
+        if (!block_source.setBlock(pos, *block, 0, nullptr, nullptr)) {
+            continue;
+        }
+        sub_chunks[{pos.x >> 4, pos.y >> 4, pos.z >> 4}].emplace_back(pos, block);
+        ++result.blocks_changed;
+    }
+    changes_.clear();
+
+    if (update_neighbors) {
+        static constexpr int offsets[][3] = {{-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}};
+        for (const auto &[sub_chunk_pos, blocks] : sub_chunks) {
+            for (const auto &[pos, block] : blocks) {
+                for (const auto &[dx, dy, dz] : offsets) {
+                    const BlockPos neighbor(pos.x + dx, pos.y + dy, pos.z + dz);
+                    block_source.getBlock(neighbor).getLegacyBlock().neighborChanged(block_source, neighbor, pos);
+                }
+            }
+        }
+    }
+
+    for (const auto &[sub_chunk_pos, blocks] : sub_chunks) {
+        const auto &[sub_chunk_x, sub_chunk_y, sub_chunk_z] = sub_chunk_pos;
+        BinaryStream stream;
+        stream.writeVarInt(sub_chunk_x, "Sub Chunk X", nullptr);
+        stream.writeVarInt(sub_chunk_y, "Sub Chunk Y", nullptr);
+        stream.writeVarInt(sub_chunk_z, "Sub Chunk Z", nullptr);
+        stream.writeUnsignedVarInt(static_cast<std::uint32_t>(blocks.size()), "Standard Blocks Changed", nullptr);
+        for (const auto &[pos, block] : blocks) {
+            stream.writeVarInt(pos.x, "X", nullptr);
+            stream.writeUnsignedVarInt(static_cast<std::uint32_t>(pos.y), "Y", nullptr);
+            stream.writeVarInt(pos.z, "Z", nullptr);
+            stream.writeUnsignedVarInt(block->getRuntimeId(), "Runtime Id", nullptr);
+            stream.writeUnsignedVarInt(BlockLegacy::UPDATE_ALL, "Update Flags", nullptr);
+            stream.writeUnsignedVarInt64(0, "Synced Update Actor Unique Id", nullptr);
+            stream.writeUnsignedVarInt(0, "Synced Update Type", nullptr);
+        }
+        stream.writeUnsignedVarInt(0, "Extra Blocks Changed", nullptr);
+
+        const DataPacket packet(static_cast<int>(MinecraftPacketIds::UpdateSubChunkBlocks), stream.getView());
+        dimension_.getHandle().sendPacketForPosition(blocks.front().first, packet, nullptr);
+        ++result.packets_sent;
+    }
+
+    result.packets_saved = result.blocks_changed - result.packets_sent;
+    return result;
+}
+
+}  // namespace endstone::core
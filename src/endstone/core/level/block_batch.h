@@ -0,0 +1,40 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <unordered_map>
+
+#include "bedrock/world/level/block/block.h"
+#include "bedrock/world/level/block_pos.h"
+#include "endstone/level/block_batch.h"
+
+namespace endstone::core {
+
+class EndstoneDimension;
+
+class EndstoneBlockBatch : public BlockBatch {
+public:
+    explicit EndstoneBlockBatch(EndstoneDimension &dimension);
+
+    Result<void> setBlock(int x, int y, int z, const BlockData &block) override;
+    [[nodiscard]] std::size_t getSize() const override;
+    BlockBatchResult commit(bool update_neighbors = true) override;
+
+private:
+    EndstoneDimension &dimension_;
+    std::unordered_map<BlockPos, const ::Block *> changes_;
+};
+
+}  // namespace endstone::core
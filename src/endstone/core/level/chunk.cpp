@@ -14,6 +14,10 @@
 
 #include "endstone/core/level/chunk.h"
 
+#include <unordered_map>
+
+#include "bedrock/world/level/block/bedrock_block_names.h"
+#include "bedrock/world/level/block_source.h"
 #include "bedrock/world/level/dimension/dimension.h"
 #include "endstone/core/server.h"
 
@@ -25,6 +29,8 @@ EndstoneChunk::EndstoneChunk(const LevelChunk &chunk) : dimension_(chunk.getDime
     z_ = chunk.getPosition().z;
 }
 
+EndstoneChunk::EndstoneChunk(::Dimension &dimension, int x, int z) : dimension_(dimension), x_(x), z_(z) {}
+
 int EndstoneChunk::getX() const
 {
     return x_;
@@ -45,4 +51,65 @@ Dimension &EndstoneChunk::getDimension() const
     return dimension_.getEndstoneDimension();
 }
 
+Result<ChunkSnapshot> EndstoneChunk::getSnapshot() const
+{
+    constexpr int size = ChunkSnapshot::SectionSize;
+    const auto &block_source = dimension_.getBlockSourceFromMainChunkSource();
+    ENDSTONE_CHECKF(block_source.getChunk(x_, z_) != nullptr, "Chunk ({}, {}) is not loaded.", x_, z_);
+
+    const int min_height = block_source.getMinHeight();
+    const int max_height = block_source.getMaxHeight();
+    const int min_x = x_ * size;
+    const int min_z = z_ * size;
+
+    std::array<int, size * size> height_map;
+    height_map.fill(min_height - 1);
+
+    std::vector<ChunkSnapshot::Section> sections;
+    sections.reserve((max_height - min_height + size - 1) / size);
+
+    // Per distinct block in a section: its palette index and whether it counts towards the height map
+    std::unordered_map<const ::Block *, std::pair<std::uint16_t, bool>> palette_indices;
+    for (int section_y = min_height; section_y < max_height; section_y += size) {
+        ChunkSnapshot::Section section;
+        section.indices.resize(size * size * size);
+        palette_indices.clear();
+        const ::Block *last_block = nullptr;
+        std::pair<std::uint16_t, bool> last_entry;
+
+        std::size_t i = 0;
+        for (int x = 0; x < size; ++x) {
+            for (int z = 0; z < size; ++z) {
+                auto &height = height_map[x * size + z];
+                for (int y = section_y; y < section_y + size; ++y) {
+                    const auto *block = &block_source.getBlock(BlockPos(min_x + x, y, min_z + z));
+                    // Runs of the same block are common, skip the palette lookup for them
+                    if (block != last_block) {
+                        auto [it, inserted] = palette_indices.try_emplace(
+                            block, static_cast<std::uint16_t>(section.palette.size()), false);
+                        if (inserted) {
+                            it->second.second = block->getName() != BedrockBlockNames::Air;
+                            section.palette.push_back(block->getRuntimeId());
+                        }
+                        last_block = block;
+                        last_entry = it->second;
+                    }
+                    section.indices[i++] = last_entry.first;
+                    if (last_entry.second) {
+                        height = y;
+                    }
+                }
+            }
+        }
+
+        if (section.palette.size() == 1) {
+            section.indices.clear();
+            section.indices.shrink_to_fit();
+        }
+        sections.push_back(std::move(section));
+    }
+
+    return ChunkSnapshot(dimension_.getName(), x_, z_, min_height, std::move(sections), height_map);
+}
+
 }  // namespace endstone::core
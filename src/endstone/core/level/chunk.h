@@ -22,10 +22,12 @@ namespace endstone::core {
 class EndstoneChunk : public Chunk {
 public:
     explicit EndstoneChunk(const LevelChunk &chunk);
+    EndstoneChunk(::Dimension &dimension, int x, int z);
     [[nodiscard]] int getX() const override;
     [[nodiscard]] int getZ() const override;
     [[nodiscard]] Level &getLevel() const override;
     [[nodiscard]] Dimension &getDimension() const override;
+    [[nodiscard]] Result<ChunkSnapshot> getSnapshot() const override;
 
 private:
     ::Dimension &dimension_;
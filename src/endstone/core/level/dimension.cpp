@@ -14,14 +14,44 @@
 
 #include "endstone/core/level/dimension.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+
+#include "bedrock/world/actor/actor.h"
 #include "bedrock/world/level/block/bedrock_block_names.h"
+#include "bedrock/world/level/block_palette.h"
 #include "bedrock/world/level/dimension/vanilla_dimensions.h"
+#include "endstone/core/actor/actor.h"
 #include "endstone/core/block/block.h"
+#include "endstone/core/block/block_data.h"
+#include "endstone/core/level/block_batch.h"
 #include "endstone/core/level/chunk.h"
 #include "endstone/core/level/level.h"
+#include "endstone/plugin/plugin.h"
 
 namespace endstone::core {
 
+namespace {
+constexpr std::size_t MaxBlockVolume = 1 << 25;
+
+// The extent is computed in 64 bits, the distance between two ints does not always fit in an int
+std::uint64_t getExtent(int min, int max)
+{
+    return static_cast<std::uint64_t>(std::int64_t{max} - min + 1);
+}
+
+bool isLoaded(const std::weak_ptr<LevelChunk> &weak_lc)
+{
+    if (weak_lc.expired()) {
+        return false;
+    }
+    const auto chunk = weak_lc.lock();
+    return chunk && chunk->getState() >= ChunkState::Loaded;
+}
+}  // namespace
+
 EndstoneDimension::EndstoneDimension(::Dimension &dimension, EndstoneLevel &level)
     : dimension_(dimension), level_(level)
 {
@@ -61,13 +91,151 @@ std::unique_ptr<Block> EndstoneDimension::getBlockAt(Location location) const
     return getBlockAt(location.getBlockX(), location.getBlockY(), location.getBlockZ());
 }
 
+Result<BlockVolume> EndstoneDimension::getBlocks(int x1, int y1, int z1, int x2, int y2, int z2) const
+{
+    const auto [min_x, max_x] = std::minmax(x1, x2);
+    const auto [min_y, max_y] = std::minmax(y1, y2);
+    const auto [min_z, max_z] = std::minmax(z1, z2);
+    ENDSTONE_CHECK_RESULT(checkBounds(min_y, max_y));
+
+    const auto size_x = getExtent(min_x, max_x);
+    const auto size_y = getExtent(min_y, max_y);
+    const auto size_z = getExtent(min_z, max_z);
+    // Divide rather than multiply, the product of the extents can overflow even in 64 bits
+    ENDSTONE_CHECKF(size_x <= MaxBlockVolume / size_y / size_z,
+                    "Region of {}x{}x{} blocks is larger than the limit of {}.", size_x, size_y, size_z,
+                    MaxBlockVolume);
+    ENDSTONE_CHECK_RESULT(checkLoaded(min_x, min_z, max_x, max_z));
+
+    BlockVolume volume(max_x - min_x + 1, max_y - min_y + 1, max_z - min_z + 1);
+
+    auto &palette = volume.getPalette();
+    auto &indices = volume.getIndices();
+    std::unordered_map<const ::Block *, std::uint16_t> palette_indices;
+    const ::Block *last_block = nullptr;
+    std::uint16_t last_index = 0;
+
+    const auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    std::size_t i = 0;
+    for (auto x = min_x; x <= max_x; ++x) {
+        for (auto z = min_z; z <= max_z; ++z) {
+            for (auto y = min_y; y <= max_y; ++y) {
+                const auto *block = &block_source.getBlock(BlockPos(x, y, z));
+                // Runs of the same block are common, skip the palette lookup for them
+                if (block != last_block) {
+                    auto [it, inserted] =
+                        palette_indices.try_emplace(block, static_cast<std::uint16_t>(palette.size()));
+                    if (inserted) {
+                        ENDSTONE_CHECK(palette.size() <= std::numeric_limits<std::uint16_t>::max(),
+                                       "Region contains too many distinct blocks.");
+                        palette.push_back(block->getRuntimeId());
+                    }
+                    last_block = block;
+                    last_index = it->second;
+                }
+                indices[i++] = last_index;
+            }
+        }
+    }
+    return volume;
+}
+
+Result<void> EndstoneDimension::setBlocks(Plugin &plugin, int x, int y, int z, BlockVolume volume,
+                                          BlockWriteOptions options)
+{
+    ENDSTONE_CHECK(volume.getVolume() > 0, "Volume must not be empty.");
+    ENDSTONE_CHECKF(volume.getVolume() <= MaxBlockVolume, "Volume of {} blocks is larger than the limit of {}.",
+                    volume.getVolume(), MaxBlockVolume);
+    ENDSTONE_CHECKF(volume.getIndices().size() == volume.getVolume(), "Volume has {} indices, expected {}.",
+                    volume.getIndices().size(), volume.getVolume());
+    ENDSTONE_CHECK_RESULT(checkBounds(y, y + volume.getSizeY() - 1));
+    ENDSTONE_CHECK_RESULT(checkLoaded(x, z, x + volume.getSizeX() - 1, z + volume.getSizeZ() - 1));
+
+    // Resolve every palette entry once
+    const auto &block_palette = getHandle().getLevel().getBlockPalette();
+    std::vector<const ::Block *> blocks;
+    blocks.reserve(volume.getPalette().size());
+    for (const auto runtime_id : volume.getPalette()) {
+        ENDSTONE_CHECKF(runtime_id < block_palette.getNumBlockNetworkIds(), "Unknown block runtime id {}.",
+                        runtime_id);
+        blocks.push_back(&block_palette.getBlock(runtime_id));
+    }
+    const auto palette_size = blocks.size();
+    ENDSTONE_CHECK(std::ranges::all_of(volume.getIndices(), [&](auto index) { return index < palette_size; }),
+                   "Volume has palette indices out of range.");
+
+    return write({&plugin, BlockPos(x, y, z), volume.getSizeX(), volume.getSizeY(), volume.getSizeZ(),
+                  std::move(blocks), std::move(volume.getIndices()),
+                  (options.update_neighbors ? BlockLegacy::UPDATE_NEIGHBORS : 0) |
+                      (options.update_clients ? BlockLegacy::UPDATE_CLIENTS : 0),
+                  options.max_blocks_per_tick, std::move(options.on_complete)});
+}
+
+Result<void> EndstoneDimension::fill(Plugin &plugin, int x1, int y1, int z1, int x2, int y2, int z2,
+                                     const BlockData &block, BlockWriteOptions options)
+{
+    const auto [min_x, max_x] = std::minmax(x1, x2);
+    const auto [min_y, max_y] = std::minmax(y1, y2);
+    const auto [min_z, max_z] = std::minmax(z1, z2);
+    ENDSTONE_CHECK_RESULT(checkBounds(min_y, max_y));
+
+    const auto size_x = getExtent(min_x, max_x);
+    const auto size_y = getExtent(min_y, max_y);
+    const auto size_z = getExtent(min_z, max_z);
+    // Divide rather than multiply, the product of the extents can overflow even in 64 bits
+    ENDSTONE_CHECKF(size_x <= MaxBlockVolume / size_y / size_z,
+                    "Region of {}x{}x{} blocks is larger than the limit of {}.", size_x, size_y, size_z,
+                    MaxBlockVolume);
+    ENDSTONE_CHECK_RESULT(checkLoaded(min_x, min_z, max_x, max_z));
+
+    return write({&plugin, BlockPos(min_x, min_y, min_z), max_x - min_x + 1, max_y - min_y + 1, max_z - min_z + 1,
+                  {&static_cast<const EndstoneBlockData &>(block).getHandle()}, {},
+                  (options.update_neighbors ? BlockLegacy::UPDATE_NEIGHBORS : 0) |
+                      (options.update_clients ? BlockLegacy::UPDATE_CLIENTS : 0),
+                  options.max_blocks_per_tick, std::move(options.on_complete)});
+}
+
+void EndstoneDimension::cancelBlockWrites(Plugin &plugin)
+{
+    std::erase_if(pending_writes_, [&plugin](const auto &write) { return write.plugin == &plugin; });
+}
+
+std::unique_ptr<BlockBatch> EndstoneDimension::beginBlockBatch()
+{
+    return std::make_unique<EndstoneBlockBatch>(*this);
+}
+
 int EndstoneDimension::getHighestBlockYAt(int x, int z) const
 {
+    const auto *air = &getAirBlock();
     const auto height = getHandle().getBlockSourceFromMainChunkSource().getHeight(
-        [](auto &block) { return block.getName() != BedrockBlockNames::Air; }, x, z);
+        [air](const ::Block &block) { return &block != air; }, x, z);
     return height - 1;
 }
 
+Result<std::vector<int>> EndstoneDimension::getHighestBlockYAt(const std::vector<int> &xs,
+                                                               const std::vector<int> &zs) const
+{
+    ENDSTONE_CHECKF(xs.size() == zs.size(), "Got {} X-coordinates and {} Z-coordinates.", xs.size(), zs.size());
+
+    const auto *air = &getAirBlock();
+    const std::function<bool(const ::Block &)> is_not_air = [air](const ::Block &block) { return &block != air; };
+    const auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+
+    std::vector<int> result;
+    result.reserve(xs.size());
+    std::unordered_map<std::int64_t, int> columns;
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        const auto key = (static_cast<std::int64_t>(xs[i]) << 32) | static_cast<std::uint32_t>(zs[i]);
+        auto [it, inserted] = columns.try_emplace(key, 0);
+        if (inserted) {
+            it->second = block_source.getHeight(is_not_air, xs[i], zs[i]) - 1;
+        }
+        result.push_back(it->second);
+    }
+    return result;
+}
+
 std::unique_ptr<Block> EndstoneDimension::getHighestBlockAt(int x, int z) const
 {
     return getBlockAt(x, getHighestBlockYAt(x, z), z);
@@ -80,8 +248,10 @@ std::unique_ptr<Block> EndstoneDimension::getHighestBlockAt(Location location) c
 
 std::vector<std::unique_ptr<Chunk>> EndstoneDimension::getLoadedChunks()
 {
+    const auto &storage = dimension_.getChunkSource().getStorage();
     std::vector<std::unique_ptr<Chunk>> chunks;
-    for (const auto &[pos, weak_lc] : dimension_.getChunkSource().getStorage()) {
+    chunks.reserve(storage.size());
+    for (const auto &[pos, weak_lc] : storage) {
         if (weak_lc.expired()) {
             continue;
         }
@@ -92,16 +262,259 @@ std::vector<std::unique_ptr<Chunk>> EndstoneDimension::getLoadedChunks()
     return chunks;
 }
 
+void EndstoneDimension::forEachLoadedChunk(const std::function<bool(int x, int z)> &visitor) const
+{
+    for (const auto &[pos, weak_lc] : dimension_.getChunkSource().getStorage()) {
+        if (isLoaded(weak_lc) && !visitor(pos.x, pos.z)) {
+            return;
+        }
+    }
+}
+
+int EndstoneDimension::getLoadedChunkCount() const
+{
+    const auto &storage = dimension_.getChunkSource().getStorage();
+    return static_cast<int>(std::count_if(storage.begin(), storage.end(),
+                                          [](const auto &entry) { return isLoaded(entry.second); }));
+}
+
 ::Dimension &EndstoneDimension::getHandle() const
 {
     return dimension_;
 }
 
+void EndstoneDimension::tick()
+{
+    while (!pending_writes_.empty()) {
+        // Take the write out of the queue while it runs, placing blocks may disable its plugin
+        auto write = std::move(pending_writes_.front());
+        pending_writes_.pop_front();
+        const auto done = resume(write);
+        if (!write.plugin->isEnabled()) {
+            continue;
+        }
+        if (!done) {
+            pending_writes_.push_front(std::move(write));
+            return;  // out of budget for this tick
+        }
+        complete(write);
+    }
+}
+
+std::vector<Actor *> EndstoneDimension::getNearbyActors(Vector<float> center, float radius,
+                                                        std::optional<std::string> type) const
+{
+    if (radius < 0) {
+        return {};
+    }
+
+    // Search the box around the sphere, then keep the actors whose position is within the radius
+    const Vec3 origin{center.getX(), center.getY(), center.getZ()};
+    const Vec3 extent{radius, radius, radius};
+    const auto radius_squared = radius * radius;
+    return fetchActors({origin - extent, origin + extent}, nullptr, [&](const ::Actor &actor) {
+        if ((EndstoneActor::getFeetPosition(actor) - origin).lengthSquared() > radius_squared) {
+            return false;
+        }
+        return !type || actor.getActorIdentifier().getCanonicalName() == *type;
+    });
+}
+
+std::vector<Actor *> EndstoneDimension::getNearbyActors(Vector<float> min, Vector<float> max,
+                                                        std::optional<std::string> type) const
+{
+    const auto [min_x, max_x] = std::minmax(min.getX(), max.getX());
+    const auto [min_y, max_y] = std::minmax(min.getY(), max.getY());
+    const auto [min_z, max_z] = std::minmax(min.getZ(), max.getZ());
+    return fetchActors({{min_x, min_y, min_z}, {max_x, max_y, max_z}}, nullptr, [&](const ::Actor &actor) {
+        return !type || actor.getActorIdentifier().getCanonicalName() == *type;
+    });
+}
+
+namespace {
+class ActorColumnsBuilder {
+public:
+    explicit ActorColumnsBuilder(std::size_t capacity)
+    {
+        columns_.ids.reserve(capacity);
+        columns_.positions.reserve(capacity * 3);
+        columns_.velocities.reserve(capacity * 3);
+        columns_.types.reserve(capacity);
+        columns_.health.reserve(capacity);
+    }
+
+    void add(const ::Actor &actor)
+    {
+        const auto &type = actor.getActorIdentifier().getCanonicalName();
+        auto [it, inserted] = type_indices_.try_emplace(type, static_cast<std::uint16_t>(type_indices_.size()));
+        if (inserted) {
+            columns_.type_names.push_back(type);
+        }
+
+        const auto position = EndstoneActor::getFeetPosition(actor);
+        const auto velocity = EndstoneActor::getPositionDelta(actor);
+        columns_.ids.push_back(actor.getOrCreateUniqueID().raw_id);
+        columns_.positions.insert(columns_.positions.end(), {position.x, position.y, position.z});
+        columns_.velocities.insert(columns_.velocities.end(), {velocity.x, velocity.y, velocity.z});
+        columns_.types.push_back(it->second);
+        columns_.health.push_back(actor.getHealth());
+    }
+
+    ActorColumns build()
+    {
+        return std::move(columns_);
+    }
+
+private:
+    ActorColumns columns_;
+    std::unordered_map<std::string, std::uint16_t> type_indices_;
+};
+}  // namespace
+
+ActorColumns EndstoneDimension::getActorColumns() const
+{
+    const auto &entities = getHandle().getLevel().getEntities();
+    ActorColumnsBuilder builder(entities.size());
+    for (const auto &entity : entities) {
+        if (!entity.hasValue()) {
+            continue;
+        }
+        const auto *actor = ::Actor::tryGetFromEntity(*entity, false);
+        if (!actor || &actor->getDimension() != &dimension_) {
+            continue;
+        }
+        builder.add(*actor);
+    }
+    return builder.build();
+}
+
+ActorColumns EndstoneDimension::getActorColumns(Vector<float> min, Vector<float> max) const
+{
+    const auto [min_x, max_x] = std::minmax(min.getX(), max.getX());
+    const auto [min_y, max_y] = std::minmax(min.getY(), max.getY());
+    const auto [min_z, max_z] = std::minmax(min.getZ(), max.getZ());
+    const auto entities = getHandle().getBlockSourceFromMainChunkSource().fetchEntities(
+        nullptr, {{min_x, min_y, min_z}, {max_x, max_y, max_z}}, true, false);
+
+    ActorColumnsBuilder builder(entities.size());
+    for (const ::Actor *actor : entities) {
+        if (!actor->isRemoved()) {
+            builder.add(*actor);
+        }
+    }
+    return builder.build();
+}
+
+std::vector<Actor *> EndstoneDimension::fetchActors(const AABB &aabb, const ::Actor *except,
+                                                    const std::function<bool(const ::Actor &)> &filter) const
+{
+    // The span refers to a buffer owned by the block source that is reused by the next fetch
+    const auto entities = getHandle().getBlockSourceFromMainChunkSource().fetchEntities(except, aabb, true, false);
+
+    std::vector<Actor *> result;
+    result.reserve(entities.size());
+    for (const ::Actor *actor : entities) {
+        if (actor->isRemoved() || (filter && !filter(*actor))) {
+            continue;
+        }
+        result.push_back(&actor->getEndstoneActor());
+    }
+    return result;
+}
+
+void EndstoneDimension::clearCachedBlocks()
+{
+    air_ = nullptr;
+}
+
+const ::Block &EndstoneDimension::getAirBlock() const
+{
+    if (!air_) {
+        auto result = level_.getServer().resolveBlock(BedrockBlockNames::Air.getString(), {});
+        if (!result) {
+            throw std::runtime_error(result.error());
+        }
+        air_ = result.value();
+    }
+    return *air_;
+}
+
+Result<void> EndstoneDimension::checkBounds(int min_y, int max_y) const
+{
+    const auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    const int min_height = block_source.getMinHeight();
+    const int max_height = block_source.getMaxHeight();
+    ENDSTONE_CHECKF(min_y >= min_height && max_y < max_height, "Y-coordinates must be between {} and {}.",
+                    min_height, max_height - 1);
+    return {};
+}
+
+Result<void> EndstoneDimension::checkLoaded(int min_x, int min_z, int max_x, int max_z) const
+{
+    const auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    for (auto chunk_x = min_x >> 4; chunk_x <= max_x >> 4; ++chunk_x) {
+        for (auto chunk_z = min_z >> 4; chunk_z <= max_z >> 4; ++chunk_z) {
+            const auto *chunk = block_source.getChunk(ChunkPos(chunk_x, chunk_z));
+            ENDSTONE_CHECKF(chunk && chunk->getState() >= ChunkState::Loaded, "Chunk ({}, {}) is not loaded.",
+                            chunk_x, chunk_z);
+        }
+    }
+    return {};
+}
+
+Result<void> EndstoneDimension::write(PendingWrite write)
+{
+    // Keep the order of writes, queue behind the ones still pending
+    if (write.max_blocks_per_tick == 0 && pending_writes_.empty()) {
+        resume(write);
+        if (write.plugin->isEnabled()) {
+            complete(write);
+        }
+        return {};
+    }
+    pending_writes_.push_back(std::move(write));
+    return {};
+}
+
+void EndstoneDimension::complete(PendingWrite &write) const
+{
+    if (!write.on_complete) {
+        return;
+    }
+    try {
+        write.on_complete();
+    }
+    catch (std::exception &e) {
+        level_.getServer().getLogger().error("Error occurred when completing a block write: {}", e.what());
+    }
+}
+
+bool EndstoneDimension::resume(PendingWrite &write)
+{
+    auto &block_source = getHandle().getBlockSourceFromMainChunkSource();
+    const auto size_y = static_cast<std::size_t>(write.size_y);
+    const auto size_zy = size_y * write.size_z;
+    const auto total = size_zy * write.size_x;
+    const auto end =
+        write.max_blocks_per_tick == 0 ? total : std::min(total, write.written + write.max_blocks_per_tick);
+
+    for (auto i = write.written; i < end; ++i) {
+        const auto *block = write.indices.empty() ? write.blocks[0] : write.blocks[write.indices[i]];
+        const BlockPos pos(write.origin.x + static_cast<int>(i / size_zy),
+                           write.origin.y + static_cast<int>(i % size_y),
+                           write.origin.z + static_cast<int>(i / size_y % write.size_z));
+        block_source.setBlock(pos, *block, write.flags, nullptr, nullptr);
+    }
+    write.written = end;
+    return write.written == total;
+}
+
 }  // namespace endstone::core
 
 endstone::Dimension &Dimension::getEndstoneDimension() const
 {
+    using endstone::core::EndstoneLevel;
     using endstone::core::EndstoneServer;
     auto &server = entt::locator<EndstoneServer>::value();
-    return *server.getLevel()->getDimension(getName());
+    return static_cast<EndstoneLevel &>(*server.getLevel()).getDimension(*this);
 }
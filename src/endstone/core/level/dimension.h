@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <deque>
+#include <functional>
+#include <optional>
+
 #include "bedrock/world/level/dimension/dimension.h"
 #include "endstone/actor/actor.h"
 #include "endstone/core/server.h"
@@ -30,16 +34,78 @@ public:
     [[nodiscard]] Level &getLevel() const override;
     [[nodiscard]] std::unique_ptr<Block> getBlockAt(int x, int y, int z) const override;
     [[nodiscard]] std::unique_ptr<Block> getBlockAt(Location location) const override;
+    [[nodiscard]] Result<BlockVolume> getBlocks(int x1, int y1, int z1, int x2, int y2, int z2) const override;
+    Result<void> setBlocks(Plugin &plugin, int x, int y, int z, BlockVolume volume,
+                           BlockWriteOptions options) override;
+    Result<void> fill(Plugin &plugin, int x1, int y1, int z1, int x2, int y2, int z2, const BlockData &block,
+                      BlockWriteOptions options) override;
+    void cancelBlockWrites(Plugin &plugin) override;
+    [[nodiscard]] std::unique_ptr<BlockBatch> beginBlockBatch() override;
     [[nodiscard]] int getHighestBlockYAt(int x, int z) const override;
+    [[nodiscard]] Result<std::vector<int>> getHighestBlockYAt(const std::vector<int> &xs,
+                                                              const std::vector<int> &zs) const override;
     [[nodiscard]] std::unique_ptr<Block> getHighestBlockAt(int x, int z) const override;
     [[nodiscard]] std::unique_ptr<Block> getHighestBlockAt(Location location) const override;
     [[nodiscard]] std::vector<std::unique_ptr<Chunk>> getLoadedChunks() override;
+    void forEachLoadedChunk(const std::function<bool(int x, int z)> &visitor) const override;
+    [[nodiscard]] int getLoadedChunkCount() const override;
+    [[nodiscard]] std::vector<Actor *> getNearbyActors(Vector<float> center, float radius,
+                                                       std::optional<std::string> type) const override;
+    [[nodiscard]] std::vector<Actor *> getNearbyActors(Vector<float> min, Vector<float> max,
+                                                       std::optional<std::string> type) const override;
+    [[nodiscard]] ActorColumns getActorColumns() const override;
+    [[nodiscard]] ActorColumns getActorColumns(Vector<float> min, Vector<float> max) const override;
 
     [[nodiscard]] ::Dimension &getHandle() const;
 
+    /**
+     * @brief Gets the actors whose bounding box intersects a box, searching only the chunks the box overlaps.
+     *
+     * @param aabb the box to search
+     * @param except an actor to leave out, or nullptr
+     * @param filter returns whether an actor should be included, or nullptr to include all of them
+     */
+    [[nodiscard]] std::vector<Actor *> fetchActors(const AABB &aabb, const ::Actor *except,
+                                                   const std::function<bool(const ::Actor &)> &filter) const;
+
+    /**
+     * @brief Writes the pending blocks of bulk writes, called once per tick.
+     */
+    void tick();
+
+    /**
+     * @brief Forgets the blocks resolved from the registry, called when the server reloads its data.
+     */
+    void clearCachedBlocks();
+
 private:
+    friend class EndstoneBlockBatch;
+
+    struct PendingWrite {
+        Plugin *plugin;
+        BlockPos origin;
+        int size_x;
+        int size_y;
+        int size_z;
+        std::vector<const ::Block *> blocks;
+        std::vector<std::uint16_t> indices;  // empty when every block is blocks[0]
+        int flags;
+        std::size_t max_blocks_per_tick;
+        std::function<void()> on_complete;
+        std::size_t written = 0;
+    };
+
+    Result<void> checkBounds(int min_y, int max_y) const;
+    Result<void> checkLoaded(int min_x, int min_z, int max_x, int max_z) const;
+    Result<void> write(PendingWrite write);
+    bool resume(PendingWrite &write);
+    void complete(PendingWrite &write) const;
+    [[nodiscard]] const ::Block &getAirBlock() const;
+
     ::Dimension &dimension_;
     EndstoneLevel &level_;
+    std::deque<PendingWrite> pending_writes_;
+    mutable const ::Block *air_ = nullptr;  // resolved on first use, compared by address when scanning columns
 };
 
 }  // namespace endstone::core
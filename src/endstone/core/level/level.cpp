@@ -37,6 +37,11 @@ EndstoneLevel::EndstoneLevel(::Level &level) : server_(entt::locator<EndstoneSer
         auto dimension = level.getOrCreateDimension(dimension_id);
         addDimension(std::make_unique<EndstoneDimension>(*dimension.unwrap(), *this));
     }
+    // Custom dimensions that already exist
+    level.forEachDimension([this](::Dimension &dimension) {
+        (void)getDimension(dimension);
+        return true;
+    });
 }
 
 std::string EndstoneLevel::getName() const
@@ -105,9 +110,42 @@ void EndstoneLevel::addDimension(std::unique_ptr<Dimension> dimension)
             "Dimension {} is a duplicate of another dimension and has been prevented from loading.", name);
         return;
     }
+
+    auto &endstone_dimension = static_cast<EndstoneDimension &>(*dimension);
+    const auto id = endstone_dimension.getHandle().getId().runtime_id;
+    if (id >= 0) {
+        if (static_cast<std::size_t>(id) >= dimensions_by_id_.size()) {
+            dimensions_by_id_.resize(id + 1, nullptr);
+        }
+        dimensions_by_id_[id] = &endstone_dimension;
+    }
     dimensions_[name] = std::move(dimension);
 }
 
+EndstoneDimension &EndstoneLevel::getDimension(const ::Dimension &dimension)
+{
+    const auto id = dimension.getId().runtime_id;
+    if (id >= 0 && static_cast<std::size_t>(id) < dimensions_by_id_.size()) {
+        if (auto *endstone_dimension = dimensions_by_id_[id]; endstone_dimension) {
+            return *endstone_dimension;
+        }
+    }
+
+    // Not seen before, e.g. a custom dimension created after the level was loaded
+    if (getDimension(dimension.getName()) == nullptr) {
+        addDimension(std::make_unique<EndstoneDimension>(const_cast<::Dimension &>(dimension), *this));
+    }
+    return static_cast<EndstoneDimension &>(*getDimension(dimension.getName()));
+}
+
+void EndstoneLevel::tick()
+{
+    // Iterate over a copy, placing blocks can fire events that look up and add dimensions not seen before
+    for (auto *dimension : getDimensions()) {
+        static_cast<EndstoneDimension &>(*dimension).tick();
+    }
+}
+
 EndstoneServer &EndstoneLevel::getServer() const
 {
     return server_;
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "bedrock/world/level/dimension/dimension.h"
 #include "bedrock/world/level/level.h"
@@ -24,6 +25,7 @@
 
 namespace endstone::core {
 
+class EndstoneDimension;
 class EndstoneServer;
 
 class EndstoneLevel : public Level {
@@ -39,6 +41,12 @@ public:
     [[nodiscard]] Dimension *getDimension(std::string name) const override;
     void addDimension(std::unique_ptr<Dimension> dimension);
 
+    /**
+     * @brief Gets the wrapper of an engine dimension, creating it on first use for dimensions added after startup.
+     */
+    [[nodiscard]] EndstoneDimension &getDimension(const ::Dimension &dimension);
+    void tick();
+
     [[nodiscard]] EndstoneServer &getServer() const;
     [[nodiscard]] ::Level &getHandle() const;
 
@@ -46,6 +54,7 @@ private:
     EndstoneServer &server_;
     ::Level &level_;
     std::unordered_map<std::string, std::unique_ptr<Dimension>> dimensions_;
+    std::vector<EndstoneDimension *> dimensions_by_id_;  // indexed by the runtime id of the engine dimension
 };
 
 }  // namespace endstone::core
@@ -0,0 +1,48 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/packet_handler_registry.h"
+
+#include <mutex>
+
+namespace endstone::core {
+
+void PacketHandlerRegistry::registerHandler(MinecraftPacketIds id, Handler handler)
+{
+    std::unique_lock lock(mutex_);
+    handlers_[id].emplace_back(std::move(handler));
+}
+
+bool PacketHandlerRegistry::hasHandlers(MinecraftPacketIds id) const
+{
+    std::shared_lock lock(mutex_);
+    return handlers_.contains(id);
+}
+
+bool PacketHandlerRegistry::handle(const NetworkIdentifier &network_id, Packet &packet) const
+{
+    std::shared_lock lock(mutex_);
+    const auto it = handlers_.find(packet.getId());
+    if (it == handlers_.end()) {
+        return true;
+    }
+    for (const auto &handler : it->second) {
+        if (!handler(network_id, packet)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace endstone::core
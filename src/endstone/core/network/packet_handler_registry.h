@@ -0,0 +1,54 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "bedrock/network/network_identifier.h"
+#include "bedrock/network/packet.h"
+
+namespace endstone::core {
+
+/**
+ * @brief Typed handlers, registered by core code, for packets received from clients.
+ *
+ * Handlers are called with the packet object the server has already deserialized, right before it is passed on to
+ * the original packet handler. Handlers must not register other handlers while being called.
+ *
+ * Plugins cannot register handlers here, because packet classes are not part of the public API. They use
+ * PacketReceiveEvent instead, and a payload changed through that event is decoded again from bytes.
+ */
+class PacketHandlerRegistry {
+public:
+    /**
+     * @brief A typed packet handler.
+     *
+     * Returns false to drop the packet, or true to pass it on to the next handler.
+     */
+    using Handler = std::function<bool(const NetworkIdentifier &, Packet &)>;
+
+    void registerHandler(MinecraftPacketIds id, Handler handler);
+    [[nodiscard]] bool hasHandlers(MinecraftPacketIds id) const;
+    [[nodiscard]] bool handle(const NetworkIdentifier &network_id, Packet &packet) const;
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<MinecraftPacketIds, std::vector<Handler>> handlers_;
+};
+
+}  // namespace endstone::core
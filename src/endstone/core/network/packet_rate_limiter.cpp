@@ -0,0 +1,115 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/packet_rate_limiter.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace endstone::core {
+
+PacketRateLimiter::PacketRateLimiter(Limits limits, double burst) : limits_(limits), burst_(std::max(burst, 1.0))
+{
+    for (auto &limit : limits_) {
+        limit = std::max(limit, 0);
+    }
+}
+
+bool PacketRateLimiter::tryAcquire(const NetworkIdentifier &network_id, SubClientId sub_client_id,
+                                   MinecraftPacketIds packet_id, std::size_t packet_size)
+{
+    const auto index = static_cast<std::size_t>(getPacketClass(packet_id));
+    const auto limit = limits_[index];
+    if (limit == 0) {
+        return true;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    auto &shard = getShard(network_id);
+    std::scoped_lock lock(shard.mutex);
+    auto &client = shard.connections[network_id].clients[static_cast<std::size_t>(sub_client_id) % MaxSubClients];
+    if (!client) {
+        client.emplace();
+        for (std::size_t i = 0; i < PacketClassCount; ++i) {
+            client->buckets[i] = {limits_[i] * burst_, now};
+        }
+    }
+
+    auto &state = *client;
+    auto &bucket = state.buckets[index];
+    const std::chrono::duration<double> elapsed = now - bucket.last_refill;
+    bucket.tokens = std::min(limit * burst_, bucket.tokens + elapsed.count() * limit);
+    bucket.last_refill = now;
+    if (bucket.tokens < 1.0) {
+        state.stats.dropped_packets++;
+        state.stats.dropped_bytes += packet_size;
+        return false;
+    }
+    bucket.tokens -= 1.0;
+    return true;
+}
+
+void PacketRateLimiter::remove(const NetworkIdentifier &network_id)
+{
+    auto &shard = getShard(network_id);
+    std::scoped_lock lock(shard.mutex);
+    shard.connections.erase(network_id);
+}
+
+PacketRateLimiter::Stats PacketRateLimiter::getStats(const NetworkIdentifier &network_id,
+                                                     SubClientId sub_client_id) const
+{
+    const auto &shard = getShard(network_id);
+    std::scoped_lock lock(shard.mutex);
+    const auto it = shard.connections.find(network_id);
+    if (it == shard.connections.end()) {
+        return {0, 0};
+    }
+    const auto &client = it->second.clients[static_cast<std::size_t>(sub_client_id) % MaxSubClients];
+    if (!client) {
+        return {0, 0};
+    }
+    return client->stats;
+}
+
+bool PacketRateLimiter::isEnabled() const
+{
+    return std::ranges::any_of(limits_, [](int limit) { return limit > 0; });
+}
+
+PacketRateLimiter::PacketClass PacketRateLimiter::getPacketClass(MinecraftPacketIds packet_id)
+{
+    switch (packet_id) {
+    case MinecraftPacketIds::PlayerAuthInputPacket:
+    case MinecraftPacketIds::MovePlayer:
+        return PacketClass::Movement;
+    case MinecraftPacketIds::Text:
+    case MinecraftPacketIds::CommandRequest:
+        return PacketClass::Chat;
+    default:
+        return PacketClass::Other;
+    }
+}
+
+PacketRateLimiter::Shard &PacketRateLimiter::getShard(const NetworkIdentifier &network_id)
+{
+    return shards_[std::hash<NetworkIdentifier>{}(network_id) % ShardCount];
+}
+
+const PacketRateLimiter::Shard &PacketRateLimiter::getShard(const NetworkIdentifier &network_id) const
+{
+    return shards_[std::hash<NetworkIdentifier>{}(network_id) % ShardCount];
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,105 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include "bedrock/common_types.h"
+#include "bedrock/network/network_identifier.h"
+#include "bedrock/network/packet.h"
+
+namespace endstone::core {
+
+/**
+ * @brief Limits the rate of packets received from each connection using token buckets.
+ *
+ * Each client of a connection, including every split-screen player, has its own bucket per class of packets. A
+ * bucket is refilled at the configured number of packets per second and holds up to burst seconds worth of packets,
+ * so short bursts such as the movement catch-up after a lag spike are not dropped. The connection states are split
+ * into shards to reduce contention between threads receiving packets.
+ */
+class PacketRateLimiter {
+public:
+    enum class PacketClass : std::uint8_t {
+        Movement,
+        Chat,
+        Other,
+        Count,
+    };
+    static constexpr std::size_t PacketClassCount = static_cast<std::size_t>(PacketClass::Count);
+    using Limits = std::array<int, PacketClassCount>;
+
+    struct Stats {
+        std::uint64_t dropped_packets;
+        std::uint64_t dropped_bytes;
+    };
+
+    /**
+     * @param limits the maximum number of packets per second for each packet class, or 0 for no limit
+     * @param burst the number of seconds worth of packets a client can send at once, at least 1
+     */
+    explicit PacketRateLimiter(Limits limits, double burst = 1.0);
+
+    /**
+     * @brief Checks whether a packet received from the given client is within the rate limit.
+     *
+     * Packets exceeding the limit are counted towards the dropped packets of the client.
+     *
+     * @return true if the packet can be handled, false if it should be dropped
+     */
+    [[nodiscard]] bool tryAcquire(const NetworkIdentifier &network_id, SubClientId sub_client_id,
+                                  MinecraftPacketIds packet_id, std::size_t packet_size);
+    void remove(const NetworkIdentifier &network_id);
+    [[nodiscard]] Stats getStats(const NetworkIdentifier &network_id, SubClientId sub_client_id) const;
+    [[nodiscard]] bool isEnabled() const;
+    [[nodiscard]] static PacketClass getPacketClass(MinecraftPacketIds packet_id);
+
+private:
+    static constexpr std::size_t MaxSubClients = 4;  // the sub-client id takes two bits of the packet header
+
+    struct Bucket {
+        double tokens;
+        std::chrono::steady_clock::time_point last_refill;
+    };
+
+    struct ClientState {
+        std::array<Bucket, PacketClassCount> buckets;
+        Stats stats{0, 0};
+    };
+
+    struct ConnectionState {
+        std::array<std::optional<ClientState>, MaxSubClients> clients;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<NetworkIdentifier, ConnectionState> connections;
+    };
+
+    static constexpr std::size_t ShardCount = 16;
+    Shard &getShard(const NetworkIdentifier &network_id);
+    [[nodiscard]] const Shard &getShard(const NetworkIdentifier &network_id) const;
+
+    Limits limits_;
+    double burst_;
+    std::array<Shard, ShardCount> shards_;
+};
+
+}  // namespace endstone::core
@@ -0,0 +1,133 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/network/server_list_ping_cache.h"
+
+#include <algorithm>
+
+namespace endstone::core {
+
+namespace {
+// Buckets of hosts that have been idle for this long are full again and can be dropped
+constexpr auto BucketIdleTimeout = std::chrono::seconds(10);
+}  // namespace
+
+ServerListPingCache::ServerListPingCache(int rate_limit) : rate_limit_(std::max(rate_limit, 0)) {}
+
+void ServerListPingCache::setOverride(const Plugin &plugin, std::string host, Override override)
+{
+    std::scoped_lock lock(mutex_);
+    overrides_.insert_or_assign(std::move(host), OverrideEntry{&plugin, std::move(override)});
+    responses_.clear();
+}
+
+void ServerListPingCache::removeOverride(const Plugin &plugin, const std::string &host)
+{
+    std::scoped_lock lock(mutex_);
+    if (const auto it = overrides_.find(host); it != overrides_.end() && it->second.plugin == &plugin) {
+        overrides_.erase(it);
+        responses_.clear();
+    }
+}
+
+void ServerListPingCache::removeOverrides(const Plugin &plugin)
+{
+    std::scoped_lock lock(mutex_);
+    if (std::erase_if(overrides_, [&](const auto &pair) { return pair.second.plugin == &plugin; }) > 0) {
+        responses_.clear();
+    }
+}
+
+std::shared_ptr<const std::string> ServerListPingCache::getResponse(std::string_view server_response,
+                                                                    const std::string &host, int port)
+{
+    Override default_override, host_override;
+    {
+        std::scoped_lock lock(mutex_);
+        if (server_response_ != server_response) {
+            server_response_ = server_response;
+            responses_.clear();
+        }
+
+        const auto &key = overrides_.contains(host) ? host : std::string{};
+        if (const auto it = responses_.find(key); it != responses_.end()) {
+            return it->second;
+        }
+
+        if (const auto it = overrides_.find({}); it != overrides_.end()) {
+            default_override = it->second.override;
+        }
+        if (!host.empty()) {
+            if (const auto it = overrides_.find(host); it != overrides_.end()) {
+                host_override = it->second.override;
+            }
+        }
+    }
+
+    // Cache miss, rebuild the response without holding the lock as overrides may call back into the server
+    ServerListPingEvent event(host, port, std::string(server_response));
+    if (!event.deserialize()) {
+        return nullptr;
+    }
+    if (default_override) {
+        default_override(event);
+    }
+    if (host_override) {
+        host_override(event);
+    }
+    auto response = std::make_shared<const std::string>(event.serialize());
+
+    std::scoped_lock lock(mutex_);
+    if (server_response_ == server_response) {
+        responses_[host_override ? host : std::string{}] = response;
+    }
+    return response;
+}
+
+bool ServerListPingCache::tryAcquire(const std::string &host)
+{
+    if (rate_limit_ == 0) {
+        return true;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    std::scoped_lock lock(mutex_);
+    if (const auto it = bucket_index_.find(host); it != bucket_index_.end()) {
+        buckets_.splice(buckets_.begin(), buckets_, it->second);
+        auto &bucket = buckets_.front();
+        const std::chrono::duration<double> elapsed = now - bucket.last_refill;
+        bucket.tokens = std::min(static_cast<double>(rate_limit_), bucket.tokens + elapsed.count() * rate_limit_);
+        bucket.last_refill = now;
+    }
+    else {
+        if (buckets_.size() >= MaxBuckets) {
+            if (now - buckets_.back().last_refill <= BucketIdleTimeout) {
+                return false;  // Every tracked host is still active, e.g. under a flood of spoofed addresses
+            }
+            bucket_index_.erase(buckets_.back().host);
+            buckets_.pop_back();
+        }
+        buckets_.push_front(Bucket{host, static_cast<double>(rate_limit_), now});
+        bucket_index_.emplace(buckets_.front().host, buckets_.begin());
+    }
+
+    auto &bucket = buckets_.front();
+    if (bucket.tokens < 1.0) {
+        return false;
+    }
+    bucket.tokens -= 1.0;
+    return true;
+}
+
+}  // namespace endstone::core
@@ -0,0 +1,101 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "endstone/event/server/server_list_ping_event.h"
+#include "endstone/plugin/plugin.h"
+
+namespace endstone::core {
+
+/**
+ * @brief Caches the server list ping responses and limits the rate at which they are sent.
+ *
+ * The response is only rebuilt when the one generated by the server changes (e.g., the number of players or the
+ * message of the day) or when the overrides registered by plugins change.
+ */
+class ServerListPingCache {
+public:
+    using Override = std::function<void(ServerListPingEvent &)>;
+
+    /**
+     * @param rate_limit the maximum number of responses sent to a single host per second, or 0 for no limit
+     */
+    explicit ServerListPingCache(int rate_limit);
+
+    void setOverride(const Plugin &plugin, std::string host, Override override);
+    void removeOverride(const Plugin &plugin, const std::string &host);
+
+    /**
+     * @brief Removes all the overrides registered by the given plugin.
+     *
+     * @param plugin the plugin that registered the overrides
+     */
+    void removeOverrides(const Plugin &plugin);
+
+    /**
+     * @brief Gets the ping response to be sent to the given host.
+     *
+     * @param server_response the ping response generated by the server
+     * @param host the host the ping is coming from
+     * @param port the port the ping is coming from
+     * @return the ping response, or nullptr if the response generated by the server cannot be parsed
+     */
+    [[nodiscard]] std::shared_ptr<const std::string> getResponse(std::string_view server_response,
+                                                                 const std::string &host, int port);
+
+    /**
+     * @brief Checks whether a response can be sent to the given host without exceeding the rate limit.
+     *
+     * At most MaxBuckets hosts are tracked. When the table is full, the least recently seen host is only evicted if it
+     * has been idle for a while, otherwise the new host is rejected.
+     *
+     * @param host the host the ping is coming from
+     * @return true if the response can be sent, false otherwise
+     */
+    [[nodiscard]] bool tryAcquire(const std::string &host);
+
+    static constexpr std::size_t MaxBuckets = 4096;
+
+private:
+    struct OverrideEntry {
+        const Plugin *plugin;
+        Override override;
+    };
+
+    struct Bucket {
+        std::string host;
+        double tokens;
+        std::chrono::steady_clock::time_point last_refill;
+    };
+
+    mutable std::mutex mutex_;
+    std::string server_response_;
+    std::unordered_map<std::string, OverrideEntry> overrides_;
+    std::unordered_map<std::string, std::shared_ptr<const std::string>> responses_;
+    int rate_limit_;
+    std::list<Bucket> buckets_;  // most recently seen first
+    std::unordered_map<std::string_view, std::list<Bucket>::iterator> bucket_index_;
+};
+
+}  // namespace endstone::core
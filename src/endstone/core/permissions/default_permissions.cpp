@@ -78,6 +78,10 @@ void DefaultPermissions::registerCommandPermissions(Permission *parent)
     registerPermission(root->getName() + ".banlist", root, "Allows the user to list all the banned ips or players.",
                        PermissionDefault::Operator);
 
+    registerPermission(root->getName() + ".hooks", root,
+                       "Allows the user to view how often the hooked server functions have been called",
+                       PermissionDefault::Operator);
+
     registerPermission(root->getName() + ".unban", root, "Allows the user to unban players.",
                        PermissionDefault::Operator);
     registerPermission(root->getName() + ".unbanip", root, "Allows the user to unban IP addresses.",
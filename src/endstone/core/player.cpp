@@ -369,6 +369,11 @@ void EndstonePlayer::setScoreTag(std::string score)
     EndstoneMob::setScoreTag(score);
 }
 
+std::vector<Actor *> EndstonePlayer::getNearbyActors(float x, float y, float z) const
+{
+    return EndstoneMob::getNearbyActors(x, y, z);
+}
+
 bool EndstonePlayer::isGliding() const
 {
     return EndstoneMob::isGliding();
@@ -612,6 +617,20 @@ std::chrono::milliseconds EndstonePlayer::getPing() const
     return std::chrono::milliseconds(peer->GetAveragePing(component->getNetworkId().guid));
 }
 
+std::uint64_t EndstonePlayer::getDroppedPacketCount() const
+{
+    const auto *component = getPlayer().tryGetComponent<UserEntityIdentifierComponent>();
+    const auto &limiter = server_.getPacketRateLimiter();
+    return limiter.getStats(component->getNetworkId(), component->getSubClientId()).dropped_packets;
+}
+
+std::uint64_t EndstonePlayer::getDroppedPacketBytes() const
+{
+    const auto *component = getPlayer().tryGetComponent<UserEntityIdentifierComponent>();
+    const auto &limiter = server_.getPacketRateLimiter();
+    return limiter.getStats(component->getNetworkId(), component->getSubClientId()).dropped_bytes;
+}
+
 void EndstonePlayer::updateCommands() const
 {
     const auto &command_map = server_.getCommandMap();
@@ -87,6 +87,7 @@ public:
     void setNameTag(std::string name) override;
     [[nodiscard]] std::string getScoreTag() const override;
     void setScoreTag(std::string score) override;
+    [[nodiscard]] std::vector<Actor *> getNearbyActors(float x, float y, float z) const override;
 
     // Mob
     [[nodiscard]] bool isGliding() const override;
@@ -139,6 +140,8 @@ public:
     void spawnParticle(std::string name, float x, float y, float z,
                        std::optional<std::string> molang_variables_json) const override;
     [[nodiscard]] std::chrono::milliseconds getPing() const override;
+    [[nodiscard]] std::uint64_t getDroppedPacketCount() const override;
+    [[nodiscard]] std::uint64_t getDroppedPacketBytes() const override;
     void updateCommands() const override;
 
     [[nodiscard]] PlayerInventory &getInventory() const override;
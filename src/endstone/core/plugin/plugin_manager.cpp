@@ -15,8 +15,11 @@
 #include "endstone/core/plugin/plugin_manager.h"
 
 #include <algorithm>
+#include <chrono>
+#include <deque>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <utility>
@@ -25,9 +28,12 @@
 #include <boost/algorithm/string/predicate.hpp>
 
 #include "endstone/core/logger_factory.h"
+#include "endstone/core/util/hook_stats.h"
 #include "endstone/event/event.h"
 #include "endstone/event/event_handler.h"
 #include "endstone/event/handler_list.h"
+#include "endstone/level/dimension.h"
+#include "endstone/level/level.h"
 #include "endstone/plugin/plugin.h"
 #include "endstone/plugin/plugin_loader.h"
 #include "endstone/scheduler/scheduler.h"
@@ -69,6 +75,11 @@ EndstonePluginManager::EndstonePluginManager(Server &server) : server_(server)
 
 void EndstonePluginManager::registerLoader(std::unique_ptr<PluginLoader> loader)
 {
+    std::vector<std::regex> filters;
+    for (const auto &pattern : loader->getPluginFileFilters()) {
+        filters.emplace_back(pattern);
+    }
+    plugin_file_filters_.push_back(std::move(filters));
     plugin_loaders_.push_back(std::move(loader));
 }
 
@@ -108,10 +119,10 @@ bool EndstonePluginManager::isPluginEnabled(Plugin *plugin) const
 
 PluginLoader *EndstonePluginManager::resolvePluginLoader(const std::string &file) const
 {
-    for (const auto &loader : plugin_loaders_) {
-        for (const auto &pattern : loader->getPluginFileFilters()) {
-            if (std::regex r(pattern); std::regex_search(file, r)) {
-                return loader.get();
+    for (std::size_t i = 0; i < plugin_loaders_.size(); ++i) {
+        for (const auto &filter : plugin_file_filters_[i]) {
+            if (std::regex_search(file, filter)) {
+                return plugin_loaders_[i].get();
             }
         }
     }
@@ -252,12 +263,9 @@ std::vector<Plugin *> EndstonePluginManager::loadPlugins(std::vector<std::string
 
 std::vector<Plugin *> EndstonePluginManager::loadPlugins(std::vector<Plugin *> candidates)
 {
-    std::vector<Plugin *> result;
-    std::unordered_map<std::string, Plugin *> plugins;
-    std::vector<std::string> loaded_plugins;
+    std::vector<Plugin *> plugins;
+    std::unordered_map<std::string, std::size_t> plugin_indices;
     std::unordered_map<std::string, std::string> plugins_provided;
-    std::unordered_map<std::string, std::vector<std::string>> dependencies;
-    std::unordered_map<std::string, std::vector<std::string>> soft_dependencies;
 
     for (auto *candidate : candidates) {
         if (!candidate) {
@@ -265,182 +273,158 @@ std::vector<Plugin *> EndstonePluginManager::loadPlugins(std::vector<Plugin *> c
         }
 
         const auto &description = candidate->getDescription();
+        const auto name = description.getName();
 
         // Check if two plugins have the same name
-        if (auto it = plugins.find(description.getName()); it != plugins.end()) {
-            server_.getLogger().error("Ambiguous plugin name '{}', which is the name of another plugin.",
-                                      description.getName());
+        if (auto it = plugin_indices.find(name); it != plugin_indices.end()) {
+            server_.getLogger().error("Ambiguous plugin name '{}', which is the name of another plugin.", name);
+            plugins[it->second] = candidate;
+        }
+        else {
+            plugin_indices.emplace(name, plugins.size());
+            plugins.push_back(candidate);
         }
-        plugins[description.getName()] = candidate;
 
         // Check if the plugin's name is one of the provides of another plugin
-        if (auto it = plugins_provided.find(description.getName()); it != plugins_provided.end()) {
-            server_.getLogger().warning("Ambiguous plugin name '{}'. It is also provided by '{}'.",
-                                        description.getName(), it->second);
+        if (auto it = plugins_provided.find(name); it != plugins_provided.end()) {
+            server_.getLogger().warning("Ambiguous plugin name '{}'. It is also provided by '{}'.", name, it->second);
             plugins_provided.erase(it);
         }
 
         for (const auto &provided : description.getProvides()) {
             // Check if any of the provides is the name of another plugin
-            if (auto it = plugins.find(provided); it != plugins.end()) {
-                server_.getLogger().warning("Plugin '{}' provides '{}', which is the name of another plugin.",
-                                            description.getName(), provided);
+            if (plugin_indices.contains(provided)) {
+                server_.getLogger().warning("Plugin '{}' provides '{}', which is the name of another plugin.", name,
+                                            provided);
                 continue;
             }
             // Check if more than one plugin provides the same name
             if (auto it = plugins_provided.find(provided); it != plugins_provided.end()) {
-                server_.getLogger().warning("'{}' is provided by both '{}' and '{}'.", provided, description.getName(),
-                                            it->second);
+                server_.getLogger().warning("'{}' is provided by both '{}' and '{}'.", provided, name, it->second);
             }
-            plugins_provided[provided] = description.getName();
+            plugins_provided[provided] = name;
         }
+    }
 
-        // Register soft dependencies
-        if (auto soft_deps = description.getSoftDepend(); !soft_deps.empty()) {
-            if (auto it = soft_dependencies.find(description.getName()); it != soft_dependencies.end()) {
-                it->second.insert(it->second.end(), soft_deps.begin(), soft_deps.end());
-            }
-            else {
-                soft_dependencies[description.getName()] = soft_deps;
+    const auto find_candidate = [&](const std::string &name) -> std::optional<std::size_t> {
+        if (auto it = plugin_indices.find(name); it != plugin_indices.end()) {
+            return it->second;
+        }
+        if (auto it = plugins_provided.find(name); it != plugins_provided.end()) {
+            return plugin_indices.at(it->second);
+        }
+        return std::nullopt;
+    };
+
+    // Build the dependency graph. An edge points from a dependency to the plugin waiting on it; hard and soft edges
+    // are counted separately so a cycle made up of soft edges only can be broken without violating a hard one.
+    struct Edge {
+        std::size_t dependent;
+        bool hard;
+    };
+    const auto count = plugins.size();
+    std::vector<std::vector<Edge>> edges(count);
+    std::vector<std::size_t> hard_pending(count, 0);
+    std::vector<std::size_t> soft_pending(count, 0);
+    std::vector<bool> done(count, false);
+    std::vector<std::size_t> unresolved;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto &description = plugins[i]->getDescription();
+        const auto name = description.getName();
+
+        bool unknown_dependency = false;
+        for (const auto &depend : description.getDepend()) {
+            if (auto index = find_candidate(depend)) {
+                edges[*index].push_back({i, true});
+                ++hard_pending[i];
             }
-            for (const auto &depend : soft_deps) {
-                // dependency_graph.add_edge(description.getName(), depend);
+            else if (!getPlugin(depend)) {
+                server_.getLogger().error("Could not load plugin '{}': Unknown dependency '{}'. Please download and "
+                                          "install it to run this plugin.",
+                                          name, depend);
+                unknown_dependency = true;
+                break;
             }
         }
+        if (unknown_dependency) {
+            unresolved.push_back(i);
+            continue;
+        }
 
-        // Register hard dependencies
-        if (auto deps = description.getDepend(); !deps.empty()) {
-            if (auto it = dependencies.find(description.getName()); it != dependencies.end()) {
-                it->second.insert(it->second.end(), deps.begin(), deps.end());
-            }
-            else {
-                dependencies[description.getName()] = deps;
-            }
-            for (const auto &depend : deps) {
-                // dependency_graph.add_edge(description.getName(), depend);
+        // Soft dependencies which are not around are simply ignored
+        for (const auto &soft_depend : description.getSoftDepend()) {
+            if (auto index = find_candidate(soft_depend); index && *index != i) {
+                edges[*index].push_back({i, false});
+                ++soft_pending[i];
             }
         }
 
-        // Process LoadBefore by adding this plugin as a soft dependency for each target
+        // LoadBefore makes this plugin a soft dependency of each target
         for (const auto &load_before : description.getLoadBefore()) {
-            if (auto it = soft_dependencies.find(load_before); it != soft_dependencies.end()) {
-                it->second.emplace_back(load_before);
-            }
-            else {
-                soft_dependencies[load_before] = {description.getName()};
-            }
-            // dependency_graph.add_edge(load_before, description.getName());
-        }
-    }
-
-    // Resolve dependency and load plugins
-    while (!plugins.empty()) {
-        bool missing_dependency = true;
-
-        // Iterate over the current plugins.
-        for (auto it = plugins.begin(); it != plugins.end();) {
-            const auto &plugin_name = it->first;
-            auto *plugin = it->second;
-
-            // Check hard dependencies: remove those already loaded.
-            bool unknown_dependency = false;
-            if (dependencies.contains(plugin_name)) {
-                auto &deps = dependencies[plugin_name];
-                for (auto dep_it = deps.begin(); dep_it != deps.end();) {
-                    const auto &dependency = *dep_it;
-                    if (std::ranges::find(loaded_plugins, dependency) != loaded_plugins.end()) {
-                        dep_it = deps.erase(dep_it);
-                    }
-                    else if (!plugins.contains(dependency) && !plugins_provided.contains(dependency)) {
-                        unknown_dependency = true;
-                        server_.getLogger().error(
-                            "Could not load plugin '{}': Unknown dependency '{}'. Please download "
-                            "and install it to run this plugin.",
-                            plugin_name, dependency);
-                        break;
-                    }
-                    else {
-                        ++dep_it;  // check for next deps
-                    }
-                }
-                if (deps.empty()) {
-                    dependencies.erase(plugin_name);
-                }
-            }
-            if (unknown_dependency) {
-                soft_dependencies.erase(plugin_name);
-                dependencies.erase(plugin_name);
-                it = plugins.erase(it);
-                continue;
+            if (auto index = find_candidate(load_before); index && *index != i) {
+                edges[i].push_back({*index, false});
+                ++soft_pending[*index];
             }
+        }
+    }
 
-            // Check soft dependencies
-            if (soft_dependencies.contains(plugin_name)) {
-                auto &soft_deps = soft_dependencies[plugin_name];
-                for (auto dep_it = soft_deps.begin(); dep_it != soft_deps.end();) {
-                    const auto &soft_dependency = *dep_it;
-                    if (!plugins.contains(soft_dependency) && !plugins_provided.contains(soft_dependency)) {
-                        // soft depend is no longer around
-                        dep_it = soft_deps.erase(dep_it);
-                    }
-                    else {
-                        ++dep_it;  // check for next deps
-                    }
-                }
-                if (soft_deps.empty()) {
-                    soft_dependencies.erase(plugin_name);
-                }
+    std::deque<std::size_t> ready;
+    const auto release = [&](std::size_t index) {
+        done[index] = true;
+        for (const auto &[dependent, hard] : edges[index]) {
+            auto &pending = hard ? hard_pending[dependent] : soft_pending[dependent];
+            if (--pending == 0 && hard_pending[dependent] == 0 && soft_pending[dependent] == 0) {
+                ready.push_back(dependent);
             }
+        }
+    };
 
-            if (!dependencies.contains(plugin_name) && !soft_dependencies.contains(plugin_name) &&
-                plugins.contains(plugin_name)) {
-                missing_dependency = false;
-                // we are clear to load!
-                if (auto *loaded_plugin = loadPlugin(*plugin)) {
-                    result.push_back(loaded_plugin);
-                    loaded_plugins.push_back(plugin_name);
-                    auto provides = loaded_plugin->getDescription().getProvides();
-                    loaded_plugins.insert(loaded_plugins.end(), provides.begin(), provides.end());
-                }
-                it = plugins.erase(it);
+    // Plugins with an unknown dependency are dropped; anything depending on them fails in loadPlugin(Plugin &).
+    for (auto index : unresolved) {
+        release(index);
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!done[i] && hard_pending[i] == 0 && soft_pending[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+
+    // Kahn's algorithm, loading plugins in discovery order whenever there is a tie
+    std::vector<Plugin *> result;
+    while (true) {
+        while (!ready.empty()) {
+            auto index = ready.front();
+            ready.pop_front();
+            if (done[index]) {
+                continue;
             }
-            else {
-                ++it;
+            if (auto *loaded_plugin = loadPlugin(*plugins[index])) {
+                result.push_back(loaded_plugin);
             }
+            release(index);
         }
 
-        if (missing_dependency) {
-            // Try a second pass: load plugins that have no hard dependencies (ignoring soft dependencies).
-            for (auto it = plugins.begin(); it != plugins.end();) {
-                const auto &plugin_name = it->first;
-                auto *plugin = it->second;
-
-                if (!dependencies.contains(plugin_name)) {
-                    soft_dependencies.erase(plugin_name);
-                    missing_dependency = false;
-
-                    auto *loaded_plugin = loadPlugin(*plugin);
-                    if (loaded_plugin != nullptr) {
-                        result.push_back(loaded_plugin);
-                        loaded_plugins.push_back(plugin_name);
-                        auto provides = loaded_plugin->getDescription().getProvides();
-                        loaded_plugins.insert(loaded_plugins.end(), provides.begin(), provides.end());
-                    }
-                    it = plugins.erase(it);
-                    break;
-                }
-                ++it;
+        // Everything left is waiting on something else. Break soft dependency cycles by loading the first plugin
+        // whose hard dependencies have all been satisfied.
+        bool progress = false;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!done[i] && hard_pending[i] == 0) {
+                ready.push_back(i);
+                progress = true;
+                break;
             }
+        }
+        if (!progress) {
+            break;
+        }
+    }
 
-            // If there are still plugins left, a circular dependency is assumed.
-            if (missing_dependency) {
-                soft_dependencies.clear();
-                dependencies.clear();
-                for (const auto &plugin : plugins) {
-                    server_.getLogger().error("Could not load '{}': circular dependency detected.", plugin.first);
-                }
-                plugins.clear();
-            }
+    // If there are still plugins left, a circular dependency is assumed.
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!done[i]) {
+            server_.getLogger().error("Could not load '{}': circular dependency detected.",
+                                      plugins[i]->getDescription().getName());
         }
     }
 
@@ -466,6 +450,12 @@ void EndstonePluginManager::disablePlugin(Plugin &plugin)
     if (plugin.isEnabled()) {
         plugin.getPluginLoader().disablePlugin(plugin);
         server_.getScheduler().cancelTasks(plugin);
+        server_.removeServerListPingOverrides(plugin);
+        if (auto *level = server_.getLevel()) {
+            for (auto *dimension : level->getDimensions()) {
+                dimension->cancelBlockWrites(plugin);
+            }
+        }
         for (auto &[name, handler] : event_handlers_) {
             handler.unregister(plugin);
         }
@@ -487,6 +477,7 @@ void EndstonePluginManager::clearPlugins()
     // TODO: recreate dependency graph
     event_handlers_.clear();
     plugin_loaders_.clear();
+    plugin_file_filters_.clear();
     permissions_.clear();
     default_perms_[PermissionLevel::Default].clear();
     default_perms_[PermissionLevel::Operator].clear();
@@ -505,6 +496,11 @@ void EndstonePluginManager::callEvent(Event &event)
         return;
     }
 
+    std::optional<std::chrono::steady_clock::time_point> start;
+    if (HookProfiler::isEnabled()) {
+        start = std::chrono::steady_clock::now();
+    }
+
     auto &handler_list = event_handlers_.emplace(event.getEventName(), event.getEventName()).first->second;
     for (const auto &handler : handler_list.getHandlers()) {
         auto &plugin = handler->getPlugin();
@@ -520,6 +516,10 @@ void EndstonePluginManager::callEvent(Event &event)
                                       plugin.getDescription().getFullName(), e.what());
         }
     }
+
+    if (start) {
+        HookProfiler::recordDispatch(std::chrono::steady_clock::now() - *start);
+    }
 }
 
 void EndstonePluginManager::registerEvent(std::string event, std::function<void(Event &)> executor,
@@ -541,6 +541,15 @@ void EndstonePluginManager::registerEvent(std::string event, std::function<void(
     }
 }
 
+bool EndstonePluginManager::hasEventHandlers(const std::string &event) const
+{
+    const auto it = event_handlers_.find(event);
+    if (it == event_handlers_.end()) {
+        return false;
+    }
+    return !it->second.empty();
+}
+
 Permission *EndstonePluginManager::getPermission(std::string name) const
 {
     std::ranges::transform(name, name.begin(), [](unsigned char c) { return std::tolower(c); });
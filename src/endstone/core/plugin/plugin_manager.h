@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <regex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -56,6 +57,7 @@ public:
     void callEvent(Event &event) override;
     void registerEvent(std::string event, std::function<void(Event &)> executor, EventPriority priority, Plugin &plugin,
                        bool ignore_cancelled) override;
+    [[nodiscard]] bool hasEventHandlers(const std::string &event) const;
 
     /** Permission system */
     [[nodiscard]] Permission *getPermission(std::string name) const override;
@@ -88,6 +90,7 @@ private:
     [[nodiscard]] PluginLoader *resolvePluginLoader(const std::string &file) const;
     Server &server_;
     std::vector<std::unique_ptr<PluginLoader>> plugin_loaders_;
+    std::vector<std::vector<std::regex>> plugin_file_filters_;  // compiled filters, parallel to plugin_loaders_
     std::vector<Plugin *> plugins_;
     std::unordered_map<std::string, Plugin *> lookup_names_;
     std::unordered_map<std::string, HandlerList> event_handlers_;
@@ -14,10 +14,13 @@
 
 #include "endstone/core/plugin/python_plugin_loader.h"
 
+#include <memory>
+
 #include <pybind11/embed.h>
 namespace py = pybind11;
 
 #include "endstone/core/logger_factory.h"
+#include "endstone/core/scheduler/scheduler.h"
 
 namespace endstone::core {
 
@@ -33,6 +36,17 @@ PythonPluginLoader::PythonPluginLoader(Server &server) : PluginLoader(server)
         server.getLogger().error("Error occurred when trying to register a plugin loader: {}", e.what());
         throw;
     }
+
+    // Drive the asyncio event loop of Python plugins from the main thread. The scheduler may outlive this loader, so
+    // the handler turns into a no-op once the loader is gone.
+    static_cast<EndstoneScheduler &>(server.getScheduler())
+        .setHeartbeatHandler([this, alive = std::weak_ptr(alive_)](std::uint64_t current_tick) {
+            if (alive.expired()) {
+                return;
+            }
+            py::gil_scoped_acquire gil{};
+            obj_.attr("_heartbeat")(current_tick);
+        });
 }
 
 PythonPluginLoader::~PythonPluginLoader()
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string_view>
 
 #include <pybind11/embed.h>
@@ -37,6 +38,7 @@ private:
     [[nodiscard]] PluginLoader *pimpl() const;
 
     pybind11::object obj_;
+    std::shared_ptr<void> alive_ = std::make_shared<bool>(true);
 };
 
 }  // namespace endstone::core
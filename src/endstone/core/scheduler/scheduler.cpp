@@ -221,6 +221,20 @@ void EndstoneScheduler::mainThreadHeartbeat(std::uint64_t current_tick)
         it = queue_.erase(it);
     }
     current_tick_ = current_tick;
+
+    if (heartbeat_handler_) {
+        try {
+            heartbeat_handler_(current_tick);
+        }
+        catch (std::exception &e) {
+            server_.getLogger().error("Error occurred in scheduler heartbeat: {}", e.what());
+        }
+    }
+}
+
+void EndstoneScheduler::setHeartbeatHandler(std::function<void(std::uint64_t)> handler)
+{
+    heartbeat_handler_ = std::move(handler);
 }
 
 void EndstoneScheduler::removeTask(TaskId id)
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <mutex>
 
 #include <moodycamel/concurrentqueue.h>
@@ -47,6 +48,7 @@ public:
     void addTask(std::shared_ptr<EndstoneTask> task);
     void mainThreadHeartbeat(std::uint64_t current_tick);
     void removeTask(TaskId id);
+    void setHeartbeatHandler(std::function<void(std::uint64_t)> handler);
 
 private:
     TaskId nextId();
@@ -65,6 +67,7 @@ private:
     std::atomic<TaskId> current_task_{0};
     TaskComparator cmp_{};
     ThreadPoolExecutor executor_;
+    std::function<void(std::uint64_t)> heartbeat_handler_;  // runs on the main thread after the tasks of each tick
 };
 
 }  // namespace endstone::core
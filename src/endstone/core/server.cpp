@@ -27,6 +27,7 @@
 #include "bedrock/shared_constants.h"
 #include "bedrock/world/item/enchanting/enchant.h"
 #include "bedrock/world/level/block/block_descriptor.h"
+#include "bedrock/world/level/dimension/dimension.h"
 #include "bedrock/world/scores/server_scoreboard.h"
 #include "endstone/color_format.h"
 #include "endstone/command/plugin_command.h"
@@ -38,6 +39,7 @@
 #include "endstone/core/inventory/item_factory.h"
 #include "endstone/core/inventory/item_type.h"
 #include "endstone/core/level/chunk.h"
+#include "endstone/core/level/dimension.h"
 #include "endstone/core/level/level.h"
 #include "endstone/core/logger_factory.h"
 #include "endstone/core/message.h"
@@ -47,6 +49,7 @@
 #include "endstone/core/registry.h"
 #include "endstone/core/signal_handler.h"
 #include "endstone/core/util/uuid.h"
+#include "endstone/event/chunk/chunk_batch_load_event.h"
 #include "endstone/event/chunk/chunk_load_event.h"
 #include "endstone/event/chunk/chunk_unload_event.h"
 #include "endstone/event/server/broadcast_message_event.h"
@@ -73,15 +76,28 @@ EndstoneServer::EndstoneServer() : logger_(LoggerFactory::getLogger("Server"))
     service_manager_ = std::make_unique<EndstoneServiceManager>();
     command_sender_ = EndstoneConsoleCommandSender::create();
     scheduler_ = std::make_unique<EndstoneScheduler>(*this);
+    packet_handler_registry_ = std::make_unique<PacketHandlerRegistry>();
     start_time_ = std::chrono::system_clock::now();
 
+    int ping_rate_limit = 10;
+    PacketRateLimiter::Limits packet_rate_limits = {0, 0, 0};
+    double packet_rate_burst = 3.0;
     try {
         toml::table tbl = toml::parse_file("endstone.toml");
         allow_client_packs_ = tbl.at_path("settings.allow-client-packs").value_or(false);
+        ping_rate_limit = tbl.at_path("settings.ping-rate-limit").value_or(ping_rate_limit);
+        auto &[movement, chat, other] = packet_rate_limits;
+        movement = tbl.at_path("packet-rate-limit.movement").value_or(movement);
+        chat = tbl.at_path("packet-rate-limit.chat").value_or(chat);
+        other = tbl.at_path("packet-rate-limit.other").value_or(other);
+        packet_rate_burst = tbl.at_path("packet-rate-limit.burst").value_or(packet_rate_burst);
     }
     catch (const toml::parse_error &err) {
         EndstoneServer::getLogger().error("Failed to parse config file: {}", err);
     }
+    server_list_ping_cache_ = std::make_unique<ServerListPingCache>(ping_rate_limit);
+    block_data_cache_ = std::make_unique<BlockDataCache>();
+    packet_rate_limiter_ = std::make_unique<PacketRateLimiter>(packet_rate_limits, packet_rate_burst);
 }
 
 EndstoneServer::~EndstoneServer() = default;
@@ -95,6 +111,7 @@ void EndstoneServer::init(ServerInstance &server_instance)
     command_sender_->init();
     player_ban_list_->load();
     ip_ban_list_->load();
+    registerPacketHandlers();
     loadPlugins();
     enablePlugins(PluginLoadOrder::Startup);
 }
@@ -105,6 +122,7 @@ void EndstoneServer::setLevel(::Level &level)
         throw std::runtime_error("Level already initialized.");
     }
     level_ = std::make_unique<EndstoneLevel>(level);
+    block_data_cache_->clear();  // the block registry is finalized with the level
     enchantment_registry_ = EndstoneRegistry<Enchantment, ::Enchant>::createRegistry();
     item_registry_ = EndstoneRegistry<ItemType, ::Item>::createRegistry();
     scoreboard_ = std::make_unique<EndstoneScoreboard>(level.getScoreboard());
@@ -113,18 +131,43 @@ void EndstoneServer::setLevel(::Level &level)
     level._getPlayerDeathManager()->sender_.reset();  // prevent BDS from sending the death message
     on_chunk_load_subscription_ = level.getLevelChunkEventManager()->getOnChunkLoadedConnector().connect(
         [&](ChunkSource & /*chunk_source*/, LevelChunk &lc, int /*closest_player_distance_squared*/) -> void {
-            if (lc.getState() >= ChunkState::Loaded) {
-                const auto chunk = std::make_unique<EndstoneChunk>(lc);
-                ChunkLoadEvent e(*chunk);
+            if (lc.getState() < ChunkState::Loaded) {
+                return;
+            }
+            // chunks are loaded in bursts, skip building the wrappers unless someone is listening
+            static const std::string load_event = ChunkLoadEvent::NAME;
+            static const std::string batch_load_event = ChunkBatchLoadEvent::NAME;
+            if (plugin_manager_->hasEventHandlers(load_event)) {
+                EndstoneChunk chunk(lc);
+                ChunkLoadEvent e(chunk);
                 getPluginManager().callEvent(e);
             }
+            if (plugin_manager_->hasEventHandlers(batch_load_event)) {
+                auto &dimension = lc.getDimension();
+                const auto &pos = lc.getPosition();
+                if (loaded_chunk_indices_.try_emplace({&dimension, pos.x, pos.z}, loaded_chunks_.size()).second) {
+                    loaded_chunks_.push_back({&dimension, pos});
+                }
+            }
         },
         Bedrock::PubSub::ConnectPosition::AtFront, nullptr);
     on_chunk_unload_subscription_ = level.getLevelChunkEventManager()->getOnChunkDiscardedConnector().connect(
         [&](LevelChunk &lc) -> void {
-            const auto chunk = std::make_unique<EndstoneChunk>(lc);
-            ChunkUnloadEvent e(*chunk);
-            getPluginManager().callEvent(e);
+            // a chunk discarded in the same tick it was loaded is not reported as loaded
+            if (!loaded_chunk_indices_.empty()) {
+                const auto &pos = lc.getPosition();
+                if (const auto it = loaded_chunk_indices_.find({&lc.getDimension(), pos.x, pos.z});
+                    it != loaded_chunk_indices_.end()) {
+                    loaded_chunks_[it->second].dimension = nullptr;
+                    loaded_chunk_indices_.erase(it);
+                }
+            }
+            static const std::string unload_event = ChunkUnloadEvent::NAME;
+            if (plugin_manager_->hasEventHandlers(unload_event)) {
+                EndstoneChunk chunk(lc);
+                ChunkUnloadEvent e(chunk);
+                getPluginManager().callEvent(e);
+            }
         },
         Bedrock::PubSub::ConnectPosition::AtFront, nullptr);
 
@@ -155,6 +198,59 @@ bool EndstoneServer::getAllowClientPacks() const
     return allow_client_packs_;
 }
 
+ServerListPingCache &EndstoneServer::getServerListPingCache() const
+{
+    return *server_list_ping_cache_;
+}
+
+BlockDataCache &EndstoneServer::getBlockDataCache() const
+{
+    return *block_data_cache_;
+}
+
+Result<const ::Block *> EndstoneServer::resolveBlock(std::string_view type, const BlockStates &block_states) const
+{
+    const auto *block = block_data_cache_->get(BlockDataCache::makeKey(type, block_states), [&]() {
+        std::unordered_map<std::string, std::variant<int, std::string, bool>> states;
+        for (const auto &state : block_states) {
+            std::visit(overloaded{[&](auto &&arg) {
+                           states.emplace(state.first, arg);
+                       }},
+                       state.second);
+        }
+        const auto block_descriptor =
+            ScriptModuleMinecraft::ScriptBlockUtils::createBlockDescriptor(std::string(type), states);
+        return block_descriptor.tryGetBlockNoLogging();
+    });
+    ENDSTONE_CHECKF(block, "Block type {} cannot be found in the registry.", type);
+    return block;
+}
+
+PacketHandlerRegistry &EndstoneServer::getPacketHandlerRegistry() const
+{
+    return *packet_handler_registry_;
+}
+
+PacketRateLimiter &EndstoneServer::getPacketRateLimiter() const
+{
+    return *packet_rate_limiter_;
+}
+
+void EndstoneServer::registerPacketHandlers()
+{
+    // Packets sent by players are dropped until the player has been created on the server
+    const auto handle_player_packet = [this](const NetworkIdentifier &network_id, Packet &packet) {
+        auto *player =
+            getServer().getMinecraft()->getServerNetworkHandler()->getServerPlayer(network_id, packet.getClientSubId());
+        if (!player) {
+            return false;
+        }
+        return player->getEndstoneActor<EndstonePlayer>().handlePacket(packet);
+    };
+    packet_handler_registry_->registerHandler(MinecraftPacketIds::SetLocalPlayerAsInit, handle_player_packet);
+    packet_handler_registry_->registerHandler(MinecraftPacketIds::PlayerAuthInputPacket, handle_player_packet);
+}
+
 void EndstoneServer::loadResourcePacks()
 {
     const auto *manager = level_->getHandle().getClientResourcePackManager();
@@ -394,6 +490,10 @@ void EndstoneServer::reload()
 void EndstoneServer::reloadData()
 {
     server_instance_->getMinecraft()->requestResourceReload();
+    block_data_cache_->clear();  // data-driven blocks may be registered again
+    for (auto *dimension : level_->getDimensions()) {
+        static_cast<EndstoneDimension *>(dimension)->clearCachedBlocks();
+    }
     level_->getHandle().loadFunctionManager();
 }
 
@@ -503,19 +603,9 @@ Result<std::unique_ptr<BlockData>> EndstoneServer::createBlockData(std::string t
 
 Result<std::unique_ptr<BlockData>> EndstoneServer::createBlockData(std::string type, BlockStates block_states) const
 {
-    std::unordered_map<std::string, std::variant<int, std::string, bool>> states;
-    for (const auto &state : block_states) {
-        std::visit(overloaded{[&](auto &&arg) {
-                       states.emplace(state.first, arg);
-                   }},
-                   state.second);
-    }
-
-    const auto block_descriptor = ScriptModuleMinecraft::ScriptBlockUtils::createBlockDescriptor(type, states);
-    const auto *block = block_descriptor.tryGetBlockNoLogging();
-    ENDSTONE_CHECKF(block, "Block type {} cannot be found in the registry.", type);
-
-    return std::make_unique<EndstoneBlockData>(const_cast<::Block &>(*block));
+    auto result = resolveBlock(type, block_states);
+    ENDSTONE_CHECK_RESULT(result);
+    return std::make_unique<EndstoneBlockData>(const_cast<::Block &>(*result.value()));
 }
 
 PlayerBanList &EndstoneServer::getBanList() const
@@ -543,6 +633,27 @@ Registry<ItemType> &EndstoneServer::getItemRegistry() const
     return *item_registry_;
 }
 
+void EndstoneServer::setServerListPingOverride(Plugin &plugin, std::string host,
+                                               std::function<void(ServerListPingEvent &)> override)
+{
+    if (!plugin.isEnabled()) {
+        getLogger().error("Plugin {} attempted to set a server list ping override while not enabled.",
+                          plugin.getName());
+        return;
+    }
+    server_list_ping_cache_->setOverride(plugin, std::move(host), std::move(override));
+}
+
+void EndstoneServer::removeServerListPingOverride(Plugin &plugin, std::string host)
+{
+    server_list_ping_cache_->removeOverride(plugin, host);
+}
+
+void EndstoneServer::removeServerListPingOverrides(Plugin &plugin)
+{
+    server_list_ping_cache_->removeOverrides(plugin);
+}
+
 EndstoneScoreboard &EndstoneServer::getPlayerBoard(const EndstonePlayer &player) const
 {
     auto it = player_boards_.find(player.getUniqueId());
@@ -590,7 +701,11 @@ void EndstoneServer::tick(std::uint64_t current_tick, const std::function<void()
     const auto start = steady_clock::now();
     // tick start
     scheduler_->mainThreadHeartbeat(current_tick);
+    if (level_) {
+        level_->tick();
+    }
     tick_function();
+    dispatchLoadedChunks();
     for (const auto &p : getOnlinePlayers()) {
         auto *player = static_cast<EndstonePlayer *>(p);
         player->checkOpStatus();
@@ -607,6 +722,34 @@ void EndstoneServer::tick(std::uint64_t current_tick, const std::function<void()
     average_usage_[idx] = current_usage_;
 }
 
+void EndstoneServer::dispatchLoadedChunks()
+{
+    if (loaded_chunks_.empty()) {
+        return;
+    }
+    // The wrappers are only built here, for the chunks still loaded. Every buffer keeps its capacity for the next tick.
+    loaded_chunk_wrappers_.clear();
+    for (const auto &[dimension, pos] : loaded_chunks_) {
+        if (dimension) {
+            loaded_chunk_wrappers_.emplace_back(*dimension, pos.x, pos.z);
+        }
+    }
+    loaded_chunks_.clear();
+    loaded_chunk_indices_.clear();
+    if (loaded_chunk_wrappers_.empty()) {
+        return;
+    }
+
+    loaded_chunk_ptrs_.clear();
+    for (auto &chunk : loaded_chunk_wrappers_) {
+        loaded_chunk_ptrs_.push_back(&chunk);
+    }
+    ChunkBatchLoadEvent e(*level_, std::move(loaded_chunk_ptrs_));
+    getPluginManager().callEvent(e);
+    // Take the buffer back from the event, the event is not const so casting away the constness is safe
+    loaded_chunk_ptrs_ = std::move(const_cast<std::vector<Chunk *> &>(e.getChunks()));
+}
+
 ServerInstance &EndstoneServer::getServer() const
 {
     return *server_instance_;
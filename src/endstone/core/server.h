@@ -15,19 +15,28 @@
 #pragma once
 
 #include <chrono>
+#include <map>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
 
 #include "bedrock/resources/resource_pack_repository_interface.h"
 #include "bedrock/server/server_instance.h"
 #include "bedrock/shared_constants.h"
 #include "endstone/core/ban/ip_ban_list.h"
 #include "endstone/core/ban/player_ban_list.h"
+#include "endstone/core/block/block_data_cache.h"
 #include "endstone/core/command/command_map.h"
 #include "endstone/core/command/console_command_sender.h"
 #include "endstone/core/crash_handler.h"
 #include "endstone/core/lang/language.h"
+#include "endstone/core/level/chunk.h"
 #include "endstone/core/level/level.h"
+#include "endstone/core/network/packet_handler_registry.h"
+#include "endstone/core/network/packet_rate_limiter.h"
+#include "endstone/core/network/server_list_ping_cache.h"
 #include "endstone/core/packs/endstone_pack_source.h"
 #include "endstone/core/player.h"
 #include "endstone/core/plugin/plugin_manager.h"
@@ -108,6 +117,10 @@ public:
     [[nodiscard]] ServiceManager &getServiceManager() const override;
     [[nodiscard]] Registry<Enchantment> &getEnchantmentRegistry() const override;
     [[nodiscard]] Registry<ItemType> &getItemRegistry() const override;
+    void setServerListPingOverride(Plugin &plugin, std::string host,
+                                   std::function<void(ServerListPingEvent &)> override) override;
+    void removeServerListPingOverride(Plugin &plugin, std::string host) override;
+    void removeServerListPingOverrides(Plugin &plugin) override;
 
     [[nodiscard]] EndstoneScoreboard &getPlayerBoard(const EndstonePlayer &player) const;
     void setPlayerBoard(EndstonePlayer &player, Scoreboard &scoreboard);
@@ -119,6 +132,11 @@ public:
     void setResourcePackRepository(Bedrock::NotNullNonOwnerPtr<IResourcePackRepository> repo);
     [[nodiscard]] PackSource &getPackSource() const;
     [[nodiscard]] bool getAllowClientPacks() const;
+    [[nodiscard]] ServerListPingCache &getServerListPingCache() const;
+    [[nodiscard]] BlockDataCache &getBlockDataCache() const;
+    [[nodiscard]] Result<const ::Block *> resolveBlock(std::string_view type, const BlockStates &block_states) const;
+    [[nodiscard]] PacketHandlerRegistry &getPacketHandlerRegistry() const;
+    [[nodiscard]] PacketRateLimiter &getPacketRateLimiter() const;
 
     [[nodiscard]] ServerInstance &getServer() const;
     [[nodiscard]] RakNetConnector &getRakNetConnector() const;
@@ -129,6 +147,8 @@ private:
     friend class EndstonePlayer;
     void enablePlugin(Plugin &plugin);
     void loadResourcePacks();
+    void registerPacketHandlers();
+    void dispatchLoadedChunks();
 
     ServerInstance *server_instance_{nullptr};
     Logger &logger_;
@@ -158,8 +178,22 @@ private:
     float current_usage_ = 0.0F;
     float average_usage_[SharedConstants::TicksPerSecond] = {0.0F};
     bool allow_client_packs_ = false;
+    std::unique_ptr<ServerListPingCache> server_list_ping_cache_;
+    std::unique_ptr<BlockDataCache> block_data_cache_;
+    std::unique_ptr<PacketHandlerRegistry> packet_handler_registry_;
+    std::unique_ptr<PacketRateLimiter> packet_rate_limiter_;
     ::Bedrock::PubSub::Subscription on_chunk_load_subscription_;
     ::Bedrock::PubSub::Subscription on_chunk_unload_subscription_;
+    // Chunks collected for ChunkBatchLoadEvent in the order they were loaded, dispatched at the end of a tick. A chunk
+    // discarded within the same tick is looked up by position and its dimension cleared.
+    struct LoadedChunk {
+        ::Dimension *dimension;
+        ChunkPos pos;
+    };
+    std::vector<LoadedChunk> loaded_chunks_;
+    std::map<std::tuple<const ::Dimension *, int, int>, std::size_t> loaded_chunk_indices_;
+    std::vector<EndstoneChunk> loaded_chunk_wrappers_;
+    std::vector<Chunk *> loaded_chunk_ptrs_;
 };
 
 }  // namespace endstone::core
@@ -0,0 +1,207 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "endstone/core/util/hook_stats.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace endstone::core {
+namespace {
+std::mutex &counters_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<HookCounter *> &counters()
+{
+    static std::vector<HookCounter *> counters;
+    return counters;
+}
+
+std::uint64_t to_ns(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+struct LocalProfile {
+    std::uint64_t samples = 0;
+    std::uint64_t original_ns = 0;
+    std::uint64_t dispatch_ns = 0;
+};
+
+constexpr std::uint32_t FlushInterval = 64;  // samples accumulated on a thread before they are flushed
+
+struct ThreadState {
+    HookProfiler::Scope *current = nullptr;
+    std::uint64_t pending_dispatch_ns = 0;
+    std::uint32_t countdown = 1;
+    std::uint32_t unflushed = 0;
+    std::uint64_t epoch = 0;
+    std::unordered_map<HookCounter *, LocalProfile> profiles;
+};
+
+ThreadState &thread_state()
+{
+    thread_local ThreadState state;
+    return state;
+}
+}  // namespace
+
+HookCounter::HookCounter(std::string_view name) : name_(name)
+{
+    HookStats::add(*this);
+}
+
+HookCounter::Profile HookCounter::getProfile() const noexcept
+{
+    return {samples_.load(std::memory_order_relaxed), original_ns_.load(std::memory_order_relaxed),
+            dispatch_ns_.load(std::memory_order_relaxed)};
+}
+
+void HookCounter::reset() noexcept
+{
+    calls_.store(0, std::memory_order_relaxed);
+    samples_.store(0, std::memory_order_relaxed);
+    original_ns_.store(0, std::memory_order_relaxed);
+    dispatch_ns_.store(0, std::memory_order_relaxed);
+}
+
+void HookStats::add(HookCounter &counter)
+{
+    std::scoped_lock lock(counters_mutex());
+    counters().push_back(&counter);
+}
+
+std::vector<HookStats::Entry> HookStats::getEntries()
+{
+    HookProfiler::flush();
+
+    std::vector<Entry> entries;
+    {
+        std::scoped_lock lock(counters_mutex());
+        entries.reserve(counters().size());
+        for (const auto *counter : counters()) {
+            if (const auto calls = counter->getCalls(); calls > 0) {
+                entries.push_back({counter->getName(), calls, counter->getProfile()});
+            }
+        }
+    }
+    std::ranges::sort(entries, [](const auto &a, const auto &b) {
+        return a.calls != b.calls ? a.calls > b.calls : a.name < b.name;
+    });
+    return entries;
+}
+
+void HookStats::reset()
+{
+    std::scoped_lock lock(counters_mutex());
+    HookProfiler::epoch_.fetch_add(1, std::memory_order_relaxed);
+    for (auto *counter : counters()) {
+        counter->reset();
+    }
+}
+
+void HookProfiler::enable(std::uint32_t sample_interval) noexcept
+{
+    sample_interval_.store(std::max<std::uint32_t>(sample_interval, 1), std::memory_order_relaxed);
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void HookProfiler::disable() noexcept
+{
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+void HookProfiler::recordDispatch(std::chrono::steady_clock::duration duration) noexcept
+{
+    thread_state().pending_dispatch_ns += to_ns(duration);
+}
+
+void HookProfiler::flush() noexcept
+{
+    auto &state = thread_state();
+    state.unflushed = 0;
+    if (const auto epoch = epoch_.load(std::memory_order_relaxed); state.epoch != epoch) {
+        state.epoch = epoch;
+        state.profiles.clear();
+        return;
+    }
+
+    for (auto &[counter, profile] : state.profiles) {
+        if (profile.samples == 0) {
+            continue;
+        }
+        counter->samples_.fetch_add(profile.samples, std::memory_order_relaxed);
+        counter->original_ns_.fetch_add(profile.original_ns, std::memory_order_relaxed);
+        counter->dispatch_ns_.fetch_add(profile.dispatch_ns, std::memory_order_relaxed);
+        profile = {};
+    }
+}
+
+HookProfiler::Scope::Scope(HookCounter &counter) noexcept
+{
+    auto &state = thread_state();
+    parent_ = state.current;
+    // events fired by the detour before it called the original
+    dispatch_ns_ = std::exchange(state.pending_dispatch_ns, 0);
+    if (--state.countdown != 0) {
+        return;
+    }
+    state.countdown = getSampleInterval();
+
+    counter_ = &counter;
+    state.current = this;
+    start_ = std::chrono::steady_clock::now();
+}
+
+HookProfiler::Scope::~Scope()
+{
+    auto &state = thread_state();
+    if (!counter_) {
+        // an unsampled call discards its own dispatch time, but it is still excluded from a sampled caller's original
+        const auto dispatch_ns = dispatch_ns_ + std::exchange(state.pending_dispatch_ns, 0);
+        if (parent_) {
+            parent_->nested_ns_ += dispatch_ns;
+        }
+        return;
+    }
+
+    const auto elapsed_ns = to_ns(std::chrono::steady_clock::now() - start_);
+    state.current = parent_;
+
+    // events fired from within the original that no nested hook has claimed
+    const auto inner_dispatch_ns = std::exchange(state.pending_dispatch_ns, 0);
+    const auto inner_endstone_ns = std::min(elapsed_ns, inner_dispatch_ns + nested_ns_);
+    const auto dispatch_ns = dispatch_ns_ + inner_dispatch_ns;
+    if (parent_) {
+        parent_->nested_ns_ += dispatch_ns + nested_ns_;
+    }
+
+    if (const auto epoch = epoch_.load(std::memory_order_relaxed); state.epoch != epoch) {
+        state.epoch = epoch;
+        state.profiles.clear();
+    }
+    auto &profile = state.profiles[counter_];
+    profile.samples++;
+    profile.original_ns += elapsed_ns - inner_endstone_ns;
+    profile.dispatch_ns += dispatch_ns;
+    if (++state.unflushed >= FlushInterval) {
+        flush();
+    }
+}
+
+}  // namespace endstone::core
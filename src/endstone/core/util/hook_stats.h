@@ -0,0 +1,174 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace endstone::core {
+
+/**
+ * @brief Counts the calls made through a single hook.
+ *
+ * Counters are created once per hook as function-local statics and register themselves with HookStats.
+ */
+class HookCounter {
+public:
+    struct Profile {
+        std::uint64_t samples;
+        std::uint64_t original_ns;
+        std::uint64_t dispatch_ns;
+    };
+
+    explicit HookCounter(std::string_view name);
+    HookCounter(const HookCounter &) = delete;
+    HookCounter &operator=(const HookCounter &) = delete;
+
+    void increment() noexcept
+    {
+        calls_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::string_view getName() const noexcept
+    {
+        return name_;
+    }
+
+    [[nodiscard]] std::uint64_t getCalls() const noexcept
+    {
+        return calls_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the timings flushed by HookProfiler so far.
+     */
+    [[nodiscard]] Profile getProfile() const noexcept;
+    void reset() noexcept;
+
+private:
+    friend class HookProfiler;
+
+    std::string_view name_;
+    alignas(64) std::atomic<std::uint64_t> calls_{0};  // keep hot counters off each other's cache lines
+    alignas(64) std::atomic<std::uint64_t> samples_{0};
+    std::atomic<std::uint64_t> original_ns_{0};
+    std::atomic<std::uint64_t> dispatch_ns_{0};
+};
+
+class HookStats {
+public:
+    struct Entry {
+        std::string_view name;
+        std::uint64_t calls;
+        HookCounter::Profile profile;
+    };
+
+    static void add(HookCounter &counter);
+
+    /**
+     * @brief Returns the counters of all hooks that have been called at least once, most called first.
+     *
+     * Only the profiler measurements of the calling thread are flushed first. Other threads flush theirs every 64
+     * samples, so their most recent samples may not be included yet.
+     */
+    [[nodiscard]] static std::vector<Entry> getEntries();
+    static void reset();
+};
+
+/**
+ * @brief Optional timing of the calls made through hooks.
+ *
+ * When enabled, every Nth call to an original function on each thread is timed. The time spent in the original is
+ * recorded separately from the time spent dispatching events to plugins, which is reported by the plugin manager
+ * through recordDispatch. Events dispatched before a hook calls its original, or from within the original, are
+ * attributed to that hook. Measurements are accumulated per thread and flushed to the counters in batches.
+ *
+ * When disabled, the only cost on the hook path is a relaxed load of the enabled flag.
+ */
+class HookProfiler {
+public:
+    class Scope {
+    public:
+        explicit Scope(HookCounter &counter) noexcept;
+        ~Scope();
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        HookCounter *counter_ = nullptr;  // null if this call is not sampled
+        Scope *parent_ = nullptr;
+        std::uint64_t dispatch_ns_ = 0;
+        std::uint64_t nested_ns_ = 0;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    [[nodiscard]] static bool isEnabled() noexcept
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    static void enable(std::uint32_t sample_interval = 1) noexcept;
+    static void disable() noexcept;
+
+    [[nodiscard]] static std::uint32_t getSampleInterval() noexcept
+    {
+        return sample_interval_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Records time spent dispatching an event to plugins on the calling thread.
+     */
+    static void recordDispatch(std::chrono::steady_clock::duration duration) noexcept;
+
+    /**
+     * @brief Flushes the measurements accumulated on the calling thread to the counters.
+     */
+    static void flush() noexcept;
+
+    template <typename Func, typename... Args>
+    static decltype(auto) invoke(HookCounter &counter, Func &&func, Args &&...args)
+    {
+        counter.increment();
+        if (!isEnabled()) [[likely]] {
+            return std::invoke(std::forward<Func>(func), std::forward<Args>(args)...);
+        }
+        Scope scope(counter);
+        return std::invoke(std::forward<Func>(func), std::forward<Args>(args)...);
+    }
+
+private:
+    friend class HookStats;
+
+    static inline std::atomic<bool> enabled_{false};
+    static inline std::atomic<std::uint32_t> sample_interval_{1};
+    static inline std::atomic<std::uint64_t> epoch_{0};  // bumped on reset to discard unflushed measurements
+};
+
+/**
+ * @brief Returns the counter of the hook identified by Key, creating it on first use.
+ */
+template <auto Key>
+HookCounter &get_hook_counter(std::string_view name)
+{
+    static HookCounter counter(name);
+    return counter;
+}
+
+}  // namespace endstone::core
@@ -18,6 +18,17 @@
 
 namespace endstone::core {
 SocketAddress EndstoneSocketAddress::fromNetworkIdentifier(const NetworkIdentifier &network_id)
+{
+    if (network_id.getType() == NetworkIdentifier::Type::RakNet) {
+        const auto &network = EndstoneServer::getInstance().getServer().getNetwork();
+        if (const auto *address = network.getSocketAddress(network_id)) {
+            return *address;
+        }
+    }
+    return resolve(network_id);
+}
+
+SocketAddress EndstoneSocketAddress::resolve(const NetworkIdentifier &network_id)
 {
     switch (network_id.getType()) {
     case NetworkIdentifier::Type::RakNet: {
@@ -21,6 +21,17 @@ namespace endstone::core {
 
 class EndstoneSocketAddress {
 public:
+    /**
+     * @brief Returns the address of a connection.
+     *
+     * RakNet addresses are resolved once when the connection is opened and kept with the connection by its
+     * NetworkSystem, see NetworkSystem::getSocketAddress. The other kinds of identifier carry their address.
+     */
     static SocketAddress fromNetworkIdentifier(const NetworkIdentifier &network_id);
+
+    /**
+     * @brief Resolves the address of a connection, asking RakNet for RakNet connections.
+     */
+    static SocketAddress resolve(const NetworkIdentifier &network_id);
 };
 }  // namespace endstone::core
@@ -51,6 +51,10 @@ void init_actor(py::module_ &m, py::class_<Actor, CommandSender> &actor, py::cla
         .def("add_scoreboard_tag", &Actor::addScoreboardTag, "Adds a tag to this actor.", py::arg("tag"))
         .def("remove_scoreboard_tag", &Actor::removeScoreboardTag, "Removes a given tag from this actor.",
              py::arg("tag"))
+        .def("get_nearby_actors", &Actor::getNearbyActors, py::arg("x"), py::arg("y"), py::arg("z"),
+             py::return_value_policy::reference,
+             "Gets the actors within a box centered on this actor, excluding this actor. The arguments are half the "
+             "size of the box along each axis.")
         .def_property("is_name_tag_visible", &Actor::isNameTagVisible, &Actor::setNameTagVisible,
                       "Gets or sets if the actor's name tag is visible or not.")
         .def_property("is_name_tag_always_visible", &Actor::isNameTagAlwaysVisible, &Actor::setNameTagAlwaysVisible,
@@ -318,7 +318,16 @@ void init_server(py::class_<Server> &server)
         .def_property_readonly("ban_list", &Server::getBanList, "Gets the player ban list.",
                                py::return_value_policy::reference)
         .def_property_readonly("ip_ban_list", &Server::getIpBanList, "Gets the IP ban list.",
-                               py::return_value_policy::reference);
+                               py::return_value_policy::reference)
+        .def("set_server_list_ping_override", &Server::setServerListPingOverride, py::arg("plugin"), py::arg("host"),
+             py::arg("override"),
+             "Sets an override for the server list ping responses sent to the given host, or to all hosts if the host "
+             "is empty. The override is only called when the cached ping response is rebuilt, and is removed when "
+             "the plugin is disabled.")
+        .def("remove_server_list_ping_override", &Server::removeServerListPingOverride, py::arg("plugin"),
+             py::arg("host"), "Removes the override for the server list ping responses sent to the given host.")
+        .def("remove_server_list_ping_overrides", &Server::removeServerListPingOverrides, py::arg("plugin"),
+             "Removes all the server list ping overrides set by the given plugin.");
 }
 
 void init_player(py::module_ &m, py::class_<OfflinePlayer> &offline_player,
@@ -397,6 +406,12 @@ void init_player(py::module_ &m, py::class_<OfflinePlayer> &offline_player,
         .def_property_readonly(
             "ping", [](const Player &self) { return self.getPing().count(); },
             "Gets the player's average ping in milliseconds.")
+        .def_property_readonly("dropped_packet_count", &Player::getDroppedPacketCount,
+                               "Gets the number of packets from this player that have been dropped by the packet rate "
+                               "limiter.")
+        .def_property_readonly("dropped_packet_bytes", &Player::getDroppedPacketBytes,
+                               "Gets the total size in bytes of the packets from this player that have been dropped by "
+                               "the packet rate limiter.")
         .def("update_commands", &Player::updateCommands, "Send the list of commands to the client.")
 
         .def_property("game_mode", &Player::getGameMode, &Player::setGameMode, "The player's current game mode.")
@@ -18,6 +18,39 @@ namespace py = pybind11;
 
 namespace endstone::python {
 
+namespace {
+// Memoryviews handed out over packet payloads, tagged with the event they were taken from. Slots are appended and
+// erased in place, so the buffer keeps its capacity from one event to the next.
+thread_local std::vector<std::pair<const Event *, py::memoryview>> payload_views;
+
+py::memoryview payload_view(const Event &event, const char *data, std::size_t size, bool readonly)
+{
+    auto view = py::memoryview::from_memory(const_cast<char *>(data), static_cast<py::ssize_t>(size), readonly);
+    payload_views.emplace_back(&event, view);
+    return view;
+}
+}  // namespace
+
+void release_payload_views(const Event &event)
+{
+    if (payload_views.empty()) {
+        return;
+    }
+    py::gil_scoped_acquire gil{};
+    std::erase_if(payload_views, [&event](auto &slot) {
+        if (slot.first != &event) {
+            return false;
+        }
+        try {
+            slot.second.attr("release")();
+        }
+        catch (py::error_already_set &e) {
+            e.discard_as_unraisable("releasing a packet payload view");
+        }
+        return true;
+    });
+}
+
 void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriority> &event_priority)
 {
     event.def_property_readonly("event_name", &Event::getEventName, "Gets a user-friendly identifier for this event.")
@@ -152,6 +185,10 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
                                "Gets the dimension primarily involved with this event");
 
     // Chunk events
+    py::class_<ChunkBatchLoadEvent, LevelEvent>(m, "ChunkBatchLoadEvent",
+                                                "Called once per tick with all the chunks loaded during that tick")
+        .def_property_readonly("chunks", &ChunkBatchLoadEvent::getChunks, py::return_value_policy::reference,
+                               "Gets the chunks loaded during the last tick");
     py::class_<ChunkEvent, DimensionEvent>(m, "ChunkEvent", "Represents a Chunk related event")
         .def_property_readonly("chunk", &ChunkEvent::getChunk, py::return_value_policy::reference,
                                "Gets the chunk being loaded/unloaded");
@@ -253,8 +290,28 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
         .def_property_readonly("packet_id", &PacketReceiveEvent::getPacketId, "Gets the ID of the packet.")
         .def_property(
             "payload", [](const PacketReceiveEvent &self) { return py::bytes(self.getPayload()); },
-            [](PacketReceiveEvent &self, const py::bytes &payload) { self.setPayload(payload); },
+            [](PacketReceiveEvent &self, const py::bytes &payload) {
+                release_payload_views(self);
+                self.setPayload(payload);
+            },
             "Gets or sets the raw packet data **excluding** the header.")
+        .def_property_readonly(
+            "payload_view",
+            [](const PacketReceiveEvent &self) {
+                const auto payload = self.getPayload();
+                return payload_view(self, payload.data(), payload.size(), true);
+            },
+            "Gets a read-only memoryview of the raw packet data **excluding** the header without copying it.\n"
+            "NOTE: The view is released when the event handler returns or the payload is replaced. Copy the data, "
+            "e.g. with bytes(view), to keep it. Views derived from it, such as slices, must not be kept either.")
+        .def_property_readonly(
+            "mutable_payload",
+            [](PacketReceiveEvent &self) {
+                const auto payload = self.getMutablePayload();
+                return payload_view(self, payload.data(), payload.size(), false);
+            },
+            "Gets a writable memoryview of the raw packet data **excluding** the header for same-length edits.\n"
+            "NOTE: The view is released when the event handler returns or the payload is replaced.")
         .def_property_readonly(
             "player", &PacketReceiveEvent::getPlayer, py::return_value_policy::reference,
             "Gets the player involved in this event\n"
@@ -269,8 +326,28 @@ void init_event(py::module_ &m, py::class_<Event> &event, py::enum_<EventPriorit
         .def_property_readonly("packet_id", &PacketSendEvent::getPacketId, "Gets the ID of the packet.")
         .def_property(
             "payload", [](const PacketSendEvent &self) { return py::bytes(self.getPayload()); },
-            [](PacketSendEvent &self, const py::bytes &payload) { self.setPayload(payload); },
+            [](PacketSendEvent &self, const py::bytes &payload) {
+                release_payload_views(self);
+                self.setPayload(payload);
+            },
             "Gets or sets the raw packet data **excluding** the header.")
+        .def_property_readonly(
+            "payload_view",
+            [](const PacketSendEvent &self) {
+                const auto payload = self.getPayload();
+                return payload_view(self, payload.data(), payload.size(), true);
+            },
+            "Gets a read-only memoryview of the raw packet data **excluding** the header without copying it.\n"
+            "NOTE: The view is released when the event handler returns or the payload is replaced. Copy the data, "
+            "e.g. with bytes(view), to keep it. Views derived from it, such as slices, must not be kept either.")
+        .def_property_readonly(
+            "mutable_payload",
+            [](PacketSendEvent &self) {
+                const auto payload = self.getMutablePayload();
+                return payload_view(self, payload.data(), payload.size(), false);
+            },
+            "Gets a writable memoryview of the raw packet data **excluding** the header for same-length edits.\n"
+            "NOTE: The view is released when the event handler returns or the payload is replaced.")
         .def_property_readonly(
             "player", &PacketSendEvent::getPlayer, py::return_value_policy::reference,
             "Gets the player involved in this event\n"
@@ -18,6 +18,19 @@ namespace py = pybind11;
 
 namespace endstone::python {
 
+namespace {
+// A view of one column of ActorColumns that keeps the columns alive, with one row per actor
+template <typename T>
+py::array_t<T> column_view(const py::object &owner, std::vector<T> &column, py::ssize_t width = 1)
+{
+    const auto rows = static_cast<py::ssize_t>(column.size()) / width;
+    if (width == 1) {
+        return py::array_t<T>(rows, column.data(), owner);
+    }
+    return py::array_t<T>({rows, width}, column.data(), owner);
+}
+}  // namespace
+
 void init_level(py::module_ &m)
 {
     auto level = py::class_<Level>(m, "Level");
@@ -59,6 +72,25 @@ void init_level(py::module_ &m)
         .def("__repr__", location_to_string)
         .def("__str__", location_to_string);
 
+    py::class_<ChunkSnapshot>(m, "ChunkSnapshot",
+                              "An immutable copy of the blocks and height map of a chunk, safe to read from any thread.")
+        .def_property_readonly("dimension_name", &ChunkSnapshot::getDimensionName,
+                               "Gets the name of the dimension this snapshot was taken from")
+        .def_property_readonly("x", &ChunkSnapshot::getX, "Gets the X-coordinate of the chunk")
+        .def_property_readonly("z", &ChunkSnapshot::getZ, "Gets the Z-coordinate of the chunk")
+        .def_property_readonly("min_height", &ChunkSnapshot::getMinHeight,
+                               "Gets the lowest Y-coordinate in the snapshot")
+        .def_property_readonly("max_height", &ChunkSnapshot::getMaxHeight,
+                               "Gets the Y-coordinate above the highest block in the snapshot")
+        .def("get_runtime_id", &ChunkSnapshot::getRuntimeId, py::arg("x"), py::arg("y"), py::arg("z"),
+             "Gets the runtime ID of the block at the given coordinates, x and z being relative to the chunk")
+        .def("get_highest_block_y_at", &ChunkSnapshot::getHighestBlockYAt, py::arg("x"), py::arg("z"),
+             "Gets the Y-coordinate of the highest non-air block at the given coordinates, relative to the chunk")
+        .def("__repr__", [](const ChunkSnapshot &self) {
+            return fmt::format("ChunkSnapshot(dimension={}, x={}, z={})", self.getDimensionName(), self.getX(),
+                               self.getZ());
+        });
+
     py::class_<Chunk>(m, "Chunk", "Represents a chunk of blocks.")
         .def_property_readonly("x", &Chunk::getX, "Gets the X-coordinate of this chunk")
         .def_property_readonly("z", &Chunk::getZ, "Gets the Z-coordinate of this chunk")
@@ -66,9 +98,87 @@ void init_level(py::module_ &m)
                                py::return_value_policy::reference)
         .def_property_readonly("dimension", &Chunk::getDimension, "Gets the dimension containing this chunk",
                                py::return_value_policy::reference)
+        .def("get_snapshot", &Chunk::getSnapshot,
+             "Takes an immutable snapshot of the blocks and height map of this chunk")
         .def("__repr__", [](const Chunk &self) { return fmt::format("{}", self); })
         .def("__str__", [](const Chunk &self) { return fmt::format("{}", self); });
 
+    py::class_<BlockVolume>(m, "BlockVolume",
+                            "Represents a cuboid of blocks, stored as a palette of block runtime IDs and one palette "
+                            "index per block.")
+        .def(py::init([](int size_x, int size_y, int size_z, std::vector<std::uint32_t> palette,
+                         const std::optional<py::array_t<std::uint16_t, py::array::c_style | py::array::forcecast>>
+                             &indices) {
+                 BlockVolume volume(size_x, size_y, size_z);
+                 volume.getPalette() = std::move(palette);
+                 if (indices) {
+                     if (static_cast<std::size_t>(indices->size()) != volume.getVolume()) {
+                         throw py::value_error(fmt::format("indices has {} elements, expected {}", indices->size(),
+                                                           volume.getVolume()));
+                     }
+                     std::copy_n(indices->data(), indices->size(), volume.getIndices().begin());
+                 }
+                 return volume;
+             }),
+             py::arg("size_x"), py::arg("size_y"), py::arg("size_z"), py::arg("palette") = std::vector<std::uint32_t>{},
+             py::arg("indices") = py::none())
+        .def_property_readonly("size_x", &BlockVolume::getSizeX, "Gets the number of blocks along the X-axis")
+        .def_property_readonly("size_y", &BlockVolume::getSizeY, "Gets the number of blocks along the Y-axis")
+        .def_property_readonly("size_z", &BlockVolume::getSizeZ, "Gets the number of blocks along the Z-axis")
+        .def_property_readonly("volume", &BlockVolume::getVolume, "Gets the total number of blocks in this volume")
+        .def_property(
+            "palette", [](const BlockVolume &self) { return self.getPalette(); },
+            [](BlockVolume &self, std::vector<std::uint32_t> palette) { self.getPalette() = std::move(palette); },
+            "The palette of block runtime IDs")
+        .def_property_readonly(
+            "indices",
+            [](py::object self) {
+                auto &indices = self.cast<BlockVolume &>().getIndices();
+                // A writable view that keeps the volume alive
+                return py::array_t<std::uint16_t>(static_cast<py::ssize_t>(indices.size()), indices.data(), self);
+            },
+            "The palette index of every block, ordered with Y varying fastest, then Z, then X")
+        .def("get_runtime_id", &BlockVolume::getRuntimeId, py::arg("x"), py::arg("y"), py::arg("z"),
+             "Gets the runtime ID of the block at the given relative coordinates");
+
+    py::class_<BlockBatchResult>(m, "BlockBatchResult", "Summarises a committed BlockBatch.")
+        .def_readonly("blocks_changed", &BlockBatchResult::blocks_changed, "The number of blocks that were changed.")
+        .def_readonly("packets_sent", &BlockBatchResult::packets_sent,
+                      "The number of packets sent to each player viewing the changes, one per sub-chunk changed.")
+        .def_readonly("packets_saved", &BlockBatchResult::packets_saved,
+                      "The number of packets each viewing player did not receive compared to one packet per block.");
+
+    py::class_<BlockBatch>(m, "BlockBatch",
+                           "Collects block changes in a dimension and applies them together, sending one packet per "
+                           "changed sub-chunk.")
+        .def("set_block", &BlockBatch::setBlock, py::arg("x"), py::arg("y"), py::arg("z"), py::arg("block"),
+             "Queues a block change, replacing any change queued earlier at the same position")
+        .def("commit", &BlockBatch::commit, py::arg("update_neighbors") = true,
+             "Applies the queued changes and sends them to clients")
+        .def("__len__", &BlockBatch::getSize);
+
+    py::class_<ActorColumns>(m, "ActorColumns",
+                             "The state of many actors at once, stored as one array per property. Row i of every "
+                             "array belongs to the same actor.")
+        .def("__len__", &ActorColumns::size)
+        .def_property_readonly(
+            "ids", [](py::object self) { return column_view(self, self.cast<ActorColumns &>().ids); },
+            "Unique ids of the actors")
+        .def_property_readonly(
+            "positions", [](py::object self) { return column_view(self, self.cast<ActorColumns &>().positions, 3); },
+            "Positions of the actors' feet, one row of x, y and z per actor")
+        .def_property_readonly(
+            "velocities",
+            [](py::object self) { return column_view(self, self.cast<ActorColumns &>().velocities, 3); },
+            "Velocities of the actors, one row of x, y and z per actor")
+        .def_property_readonly(
+            "types", [](py::object self) { return column_view(self, self.cast<ActorColumns &>().types); },
+            "Index of each actor's type in type_names")
+        .def_property_readonly(
+            "health", [](py::object self) { return column_view(self, self.cast<ActorColumns &>().health); },
+            "Health of the actors")
+        .def_readonly("type_names", &ActorColumns::type_names, "The distinct actor types, e.g. minecraft:zombie");
+
     py::enum_<Dimension::Type>(dimension, "Type", "Represents various dimension types.")
         .value("OVERWORLD", Dimension::Type::Overworld)
         .value("NETHER", Dimension::Type::Nether)
@@ -84,13 +194,77 @@ void init_level(py::module_ &m)
              py::arg("location").noconvert(), "Gets the Block at the given Location")
         .def("get_block_at", py::overload_cast<int, int, int>(&Dimension::getBlockAt, py::const_), py::arg("x"),
              py::arg("y"), py::arg("z"), "Gets the Block at the given coordinates")
-        .def("get_highest_block_y_at", &Dimension::getHighestBlockYAt, py::arg("x"), py::arg("z"),
-             "Gets the highest non-empty (impassable) coordinate at the given coordinates.")
+        .def("get_blocks", &Dimension::getBlocks, py::arg("x1"), py::arg("y1"), py::arg("z1"), py::arg("x2"),
+             py::arg("y2"), py::arg("z2"),
+             "Reads the blocks in a cuboid, corners inclusive. Every chunk it overlaps must be loaded.")
+        .def(
+            "set_blocks",
+            [](Dimension &self, Plugin &plugin, int x, int y, int z, BlockVolume volume, bool update_neighbors,
+               bool update_clients, std::size_t max_blocks_per_tick, std::function<void()> on_complete) {
+                return self.setBlocks(plugin, x, y, z, std::move(volume),
+                                      {update_neighbors, update_clients, max_blocks_per_tick, std::move(on_complete)});
+            },
+            py::arg("plugin"), py::arg("x"), py::arg("y"), py::arg("z"), py::arg("volume"), py::kw_only(),
+            py::arg("update_neighbors") = true, py::arg("update_clients") = true, py::arg("max_blocks_per_tick") = 0,
+            py::arg("on_complete") = py::none(),
+            "Writes the blocks of a volume into this dimension, starting at its minimum corner. Every chunk it "
+            "overlaps must be loaded, pending writes are cancelled when the plugin is disabled.")
+        .def(
+            "fill",
+            [](Dimension &self, Plugin &plugin, int x1, int y1, int z1, int x2, int y2, int z2, const BlockData &block,
+               bool update_neighbors, bool update_clients, std::size_t max_blocks_per_tick,
+               std::function<void()> on_complete) {
+                return self.fill(plugin, x1, y1, z1, x2, y2, z2, block,
+                                 {update_neighbors, update_clients, max_blocks_per_tick, std::move(on_complete)});
+            },
+            py::arg("plugin"), py::arg("x1"), py::arg("y1"), py::arg("z1"), py::arg("x2"), py::arg("y2"),
+            py::arg("z2"), py::arg("block"), py::kw_only(), py::arg("update_neighbors") = true,
+            py::arg("update_clients") = true, py::arg("max_blocks_per_tick") = 0, py::arg("on_complete") = py::none(),
+            "Fills a cuboid with a single block, corners inclusive. Every chunk it overlaps must be loaded, pending "
+            "writes are cancelled when the plugin is disabled.")
+        .def("cancel_block_writes", &Dimension::cancelBlockWrites, py::arg("plugin"),
+             "Cancels the pending block writes made by a plugin.")
+        .def("begin_block_batch", &Dimension::beginBlockBatch,
+             "Starts collecting block changes to be applied together.")
+        .def("get_highest_block_y_at", py::overload_cast<int, int>(&Dimension::getHighestBlockYAt, py::const_),
+             py::arg("x"), py::arg("z"), "Gets the highest non-empty (impassable) coordinate at the given coordinates.")
+        .def("get_highest_block_y_at",
+             py::overload_cast<const std::vector<int> &, const std::vector<int> &>(&Dimension::getHighestBlockYAt,
+                                                                                   py::const_),
+             py::arg("xs"), py::arg("zs"),
+             "Gets the highest non-empty (impassable) coordinates of many columns at once, scanning each distinct "
+             "column once.")
         .def("get_highest_block_at", py::overload_cast<Location>(&Dimension::getHighestBlockAt, py::const_),
              py::arg("location").noconvert(), "Gets the highest non-empty (impassable) block at the given Location.")
         .def("get_highest_block_at", py::overload_cast<int, int>(&Dimension::getHighestBlockAt, py::const_),
              py::arg("x"), py::arg("z"), "Gets the highest non-empty (impassable) block at the given coordinates.")
-        .def_property_readonly("loaded_chunks", &Dimension::getLoadedChunks, "Gets a list of all loaded Chunks");
+        .def("get_nearby_actors",
+             py::overload_cast<Vector<float>, float, std::optional<std::string>>(&Dimension::getNearbyActors,
+                                                                                 py::const_),
+             py::arg("center"), py::arg("radius"), py::arg("type") = py::none(), py::return_value_policy::reference,
+             "Gets the actors within a given distance of a position, optionally only those of the given type.")
+        .def("get_nearby_actors",
+             py::overload_cast<Vector<float>, Vector<float>, std::optional<std::string>>(&Dimension::getNearbyActors,
+                                                                                         py::const_),
+             py::arg("min"), py::arg("max"), py::arg("type") = py::none(), py::return_value_policy::reference,
+             "Gets the actors whose bounding box intersects a box, optionally only those of the given type.")
+        .def("get_actor_columns", py::overload_cast<>(&Dimension::getActorColumns, py::const_),
+             "Gets the state of every actor in this dimension in a single pass.")
+        .def("get_actor_columns",
+             py::overload_cast<Vector<float>, Vector<float>>(&Dimension::getActorColumns, py::const_), py::arg("min"),
+             py::arg("max"), "Gets the state of the actors whose bounding box intersects a box in a single pass.")
+        .def(
+            "for_each_loaded_chunk",
+            [](const Dimension &self, const py::function &visitor) {
+                // only an explicit False stops, a visitor that returns nothing visits every chunk
+                self.forEachLoadedChunk([&visitor](int x, int z) { return !visitor(x, z).is(py::bool_(false)); });
+            },
+            py::arg("visitor"),
+            "Calls a function with the coordinates of each loaded chunk, returning False stops the iteration. The "
+            "visitor must not load or unload chunks.")
+        .def_property_readonly("loaded_chunks", &Dimension::getLoadedChunks, "Gets a list of all loaded Chunks")
+        .def_property_readonly("loaded_chunk_count", &Dimension::getLoadedChunkCount,
+                               "Gets the number of loaded chunks");
 
     level.def_property_readonly("name", &Level::getName, "Gets the unique name of this level")
         .def_property_readonly("actors", &Level::getActors, "Get a list of all actors in this level",
@@ -17,6 +17,7 @@
 namespace py = pybind11;
 
 namespace endstone::python {
+void release_payload_views(const Event &event);
 
 class PyPlugin : public Plugin {
 public:
@@ -79,6 +80,11 @@ public:
     {
         return {"\\.whl"};
     }
+
+    void disablePlugin(Plugin &plugin) const override
+    {
+        PYBIND11_OVERRIDE_NAME(void, PluginLoader, "disable_plugin", disablePlugin, std::ref(plugin));
+    }
 };
 
 namespace {
@@ -192,7 +198,7 @@ void init_plugin(py::module &m)
         .def("load_plugins", &PluginLoader::loadPlugins, py::arg("directory"),
              py::return_value_policy::reference_internal, "Loads the plugin contained within the specified directory")
         .def("enable_plugin", &PluginLoader::enablePlugin, py::arg("plugin"), "Enables the specified plugin")
-        .def("disable_plugin", &PluginLoader::enablePlugin, py::arg("plugin"), "Disables the specified plugin")
+        .def("disable_plugin", &PluginLoader::disablePlugin, py::arg("plugin"), "Disables the specified plugin")
         .def_property_readonly("plugin_file_filters", &PluginLoader::getPluginFileFilters,
                                "Returns a list of all filename filters expected by this PluginLoader")
         .def_property_readonly("server", &PluginLoader::getServer, py::return_value_policy::reference,
@@ -225,7 +231,19 @@ void init_plugin(py::module &m)
             [](PluginManager &self, std::string event, const std::function<void(Event *)> &executor,
                EventPriority priority, Plugin &plugin, bool ignore_cancelled) {
                 self.registerEvent(
-                    std::move(event), [executor](Event &e) { executor(&e); }, priority, plugin, ignore_cancelled);
+                    std::move(event),
+                    [executor](Event &e) {
+                        // memoryviews taken during the call must not outlive the payload they point to
+                        struct ViewReleaser {
+                            Event &event;
+                            ~ViewReleaser()
+                            {
+                                release_payload_views(event);
+                            }
+                        } releaser{e};
+                        executor(&e);
+                    },
+                    priority, plugin, ignore_cancelled);
             },
             py::arg("name"), py::arg("executor"), py::arg("priority"), py::arg("plugin"), py::arg("ignore_cancelled"),
             "Registers the given event")
@@ -32,6 +32,9 @@ void init_scheduler(py::module &m)
         .def("run_task", &Scheduler::runTaskTimer, py::arg("plugin"), py::arg("task"), py::arg("delay") = 0,
              py::arg("period") = 0, "Returns a task that will be executed synchronously",
              py::return_value_policy::reference)
+        .def("run_task_async", &Scheduler::runTaskTimerAsync, py::arg("plugin"), py::arg("task"), py::arg("delay") = 0,
+             py::arg("period") = 0, "Returns a task that will be executed asynchronously on a worker thread",
+             py::return_value_policy::reference)
         .def("cancel_task", &Scheduler::cancelTask, py::arg("id"), "Removes task from scheduler.")
         .def("cancel_tasks", &Scheduler::cancelTasks, py::arg("plugin"),
              "Removes all tasks associated with a particular plugin from the scheduler.")
@@ -20,68 +20,183 @@
 #include "endstone/endstone.hpp"
 
 namespace pybind11::detail {
+// Strong references to uuid.UUID and the helpers used to convert it. Populated lazily with the GIL held and
+// released from an atexit hook so nothing outlives the interpreter.
+struct uuid_type_cache {
+    PyObject *uuid_class = nullptr;
+    PyObject *safe_uuid_unknown = nullptr;
+    PyObject *int_name = nullptr;
+    PyObject *is_safe_name = nullptr;
+    PyObject *bytes_kwnames = nullptr;
+    PyObject *shift = nullptr;
+    bool has_slots = false;  // whether UUID instances can be filled in without running UUID.__init__
+
+    static uuid_type_cache *get()
+    {
+        auto &cache = instance();
+        if (!cache.uuid_class && !cache.init()) {
+            return nullptr;
+        }
+        return &cache;
+    }
+
+    bool init()
+    {
+        auto uuid_module = reinterpret_steal<object>(PyImport_ImportModule("uuid"));
+        if (!uuid_module) {
+            return false;
+        }
+        auto cls = reinterpret_steal<object>(PyObject_GetAttrString(uuid_module.ptr(), "UUID"));
+        auto safe_uuid = reinterpret_steal<object>(PyObject_GetAttrString(uuid_module.ptr(), "SafeUUID"));
+        if (!cls || !safe_uuid || !PyType_Check(cls.ptr())) {
+            return false;
+        }
+        if (uuid_class) {
+            return true;  // populated by another thread while the import released the GIL
+        }
+
+        try {
+            auto slots = cls.attr("__slots__");
+            has_slots = slots.contains("int") && slots.contains("is_safe");
+        }
+        catch (error_already_set &) {
+            has_slots = false;
+        }
+
+        try {
+            module_::import("atexit").attr("register")(cpp_function([]() { instance().clear(); }));
+        }
+        catch (error_already_set &e) {
+            e.restore();
+            return false;
+        }
+        if (uuid_class) {
+            return true;
+        }
+
+        safe_uuid_unknown = PyObject_GetAttrString(safe_uuid.ptr(), "unknown");
+        int_name = PyUnicode_InternFromString("int");
+        is_safe_name = PyUnicode_InternFromString("is_safe");
+        bytes_kwnames = Py_BuildValue("(s)", "bytes");
+        shift = PyLong_FromLong(64);
+        if (!safe_uuid_unknown || !int_name || !is_safe_name || !bytes_kwnames || !shift) {
+            clear();
+            return false;
+        }
+        uuid_class = cls.release().ptr();
+        return true;
+    }
+
+    void clear()
+    {
+        Py_CLEAR(uuid_class);
+        Py_CLEAR(safe_uuid_unknown);
+        Py_CLEAR(int_name);
+        Py_CLEAR(is_safe_name);
+        Py_CLEAR(bytes_kwnames);
+        Py_CLEAR(shift);
+    }
+
+private:
+    static uuid_type_cache &instance()
+    {
+        static uuid_type_cache cache;
+        return cache;
+    }
+};
+
 template <>
 class type_caster<endstone::UUID> {
 public:
     // Python -> C++
     bool load(handle src, bool)
     {
-        /* Extract PyObject from handle */
-        PyObject *source = src.ptr();
+        auto *cache = uuid_type_cache::get();
+        if (!cache) {
+            return false;
+        }
 
         /* Check if the Python Object is a UUID instance */
-        PyObject *uuid_module = PyImport_ImportModule("uuid");
-        PyObject *uuid_class = PyObject_GetAttrString(uuid_module, "UUID");
-        if (!PyObject_IsInstance(source, uuid_class)) {
+        PyObject *source = src.ptr();
+        if (Py_TYPE(source) != reinterpret_cast<PyTypeObject *>(cache->uuid_class) &&
+            PyObject_IsInstance(source, cache->uuid_class) != 1) {
             PyErr_SetString(PyExc_TypeError, "Object is not an instance of UUID");
-            Py_XDECREF(uuid_module);
-            Py_XDECREF(uuid_class);
             return false;
         }
 
-        /* Now try to convert into C++ object */
-        PyObject *bytes = PyObject_GetAttrString(source, "bytes");
-        if (PyBytes_GET_SIZE(bytes) != 16) {
-            PyErr_SetString(PyExc_ValueError, "UUID bytes size must be 16");
-            Py_XDECREF(bytes);
-            Py_XDECREF(uuid_module);
-            Py_XDECREF(uuid_class);
+        /* Split the 128-bit integer value into two halves, most significant first */
+        auto int_value = reinterpret_steal<object>(PyObject_GetAttr(source, cache->int_name));
+        if (!int_value || !PyLong_Check(int_value.ptr())) {
+            PyErr_SetString(PyExc_TypeError, "UUID.int must be an integer");
             return false;
         }
-
-        const char *bytes_data = PyBytes_AS_STRING(bytes);
-        for (int i = 0; i < 16; i++) {
-            value.data[i] = bytes_data[i];
+        auto high = reinterpret_steal<object>(PyNumber_Rshift(int_value.ptr(), cache->shift));
+        if (!high) {
+            return false;
+        }
+        auto hi = PyLong_AsUnsignedLongLongMask(high.ptr());
+        auto lo = PyLong_AsUnsignedLongLongMask(int_value.ptr());
+        if (PyErr_Occurred()) {
+            return false;
         }
 
-        /* Clean up */
-        Py_XDECREF(bytes);
-        Py_XDECREF(uuid_module);
-        Py_XDECREF(uuid_class);
-        return PyErr_Occurred() == nullptr;
+        for (int i = 7; i >= 0; --i) {
+            value.data[i] = static_cast<std::uint8_t>(hi & 0xFF);
+            value.data[i + 8] = static_cast<std::uint8_t>(lo & 0xFF);
+            hi >>= 8;
+            lo >>= 8;
+        }
+        return true;
     }
 
     // C++ -> Python
     static handle cast(endstone::UUID src, return_value_policy /* policy */, handle /* parent */)
     {
-        PyObject *uuid_module = PyImport_ImportModule("uuid");
-        PyObject *uuid_class = PyObject_GetAttrString(uuid_module, "UUID");
-
-        // Create Python bytes object from the UUID struct data.
-        PyObject *py_bytes = PyBytes_FromStringAndSize(reinterpret_cast<const char *>(src.data), 16);
+        auto *cache = uuid_type_cache::get();
+        if (!cache) {
+            return nullptr;
+        }
 
-        // Create a dictionary to hold keyword arguments for the UUID constructor.
-        PyObject *kwargs = PyDict_New();
-        PyDict_SetItemString(kwargs, "bytes", py_bytes);
+        if (!cache->has_slots) {
+            // Fall back to UUID(bytes=...)
+            auto py_bytes = reinterpret_steal<object>(
+                PyBytes_FromStringAndSize(reinterpret_cast<const char *>(src.data), sizeof(src.data)));
+            if (!py_bytes) {
+                return nullptr;
+            }
+            PyObject *args[] = {py_bytes.ptr()};
+            return PyObject_Vectorcall(cache->uuid_class, args, 0, cache->bytes_kwnames);
+        }
 
-        PyObject *res = PyObject_Call(uuid_class, PyTuple_New(0), kwargs);
+        std::uint64_t hi = 0;
+        std::uint64_t lo = 0;
+        for (int i = 0; i < 8; ++i) {
+            hi = (hi << 8) | src.data[i];
+            lo = (lo << 8) | src.data[i + 8];
+        }
 
-        Py_XDECREF(py_bytes);
-        Py_XDECREF(kwargs);
-        Py_XDECREF(uuid_module);
-        Py_XDECREF(uuid_class);
+        auto high = reinterpret_steal<object>(PyLong_FromUnsignedLongLong(hi));
+        auto low = reinterpret_steal<object>(PyLong_FromUnsignedLongLong(lo));
+        if (!high || !low) {
+            return nullptr;
+        }
+        auto shifted = reinterpret_steal<object>(PyNumber_Lshift(high.ptr(), cache->shift));
+        if (!shifted) {
+            return nullptr;
+        }
+        auto int_value = reinterpret_steal<object>(PyNumber_Or(shifted.ptr(), low.ptr()));
+        if (!int_value) {
+            return nullptr;
+        }
 
-        return {res};
+        // UUID is immutable through __setattr__, so fill in its slots directly like UUID.__init__ does
+        auto *type = reinterpret_cast<PyTypeObject *>(cache->uuid_class);
+        auto result = reinterpret_steal<object>(type->tp_alloc(type, 0));
+        if (!result || PyObject_GenericSetAttr(result.ptr(), cache->int_name, int_value.ptr()) != 0 ||
+            PyObject_GenericSetAttr(result.ptr(), cache->is_safe_name, cache->safe_uuid_unknown) != 0) {
+            return nullptr;
+        }
+        return result.release();
     }
 
     PYBIND11_TYPE_CASTER(endstone::UUID, const_name("uuid.UUID"));
@@ -24,6 +24,8 @@ NetworkPeer::DataStatus NetworkConnection::receivePacket(std::string &receive_bu
                                                          const NetworkPeer::PacketRecvTimepointPtr &timepoint_ptr)
 {
     const auto &server = endstone::core::EndstoneServer::getInstance();
+    const auto &plugin_manager = static_cast<endstone::core::EndstonePluginManager &>(server.getPluginManager());
+    auto &rate_limiter = server.getPacketRateLimiter();
 
     while (true) {
         const auto status =
@@ -32,6 +34,12 @@ NetworkPeer::DataStatus NetworkConnection::receivePacket(std::string &receive_bu
             return status;
         }
 
+        // Nothing to check, leave the packet to the original handler without decoding the header or the player
+        const bool has_listeners = plugin_manager.hasEventHandlers(endstone::PacketReceiveEvent::NAME);
+        if (!has_listeners && !rate_limiter.isEnabled()) {
+            return status;
+        }
+
         ReadOnlyBinaryStream stream(receive_buffer, false);
         const auto header_result = stream.getUnsignedVarInt().logError(Bedrock::LogLevel::Error, LogAreaID::Network);
         if (!header_result) {
@@ -42,6 +50,13 @@ NetworkPeer::DataStatus NetworkConnection::receivePacket(std::string &receive_bu
         const auto packet_id = static_cast<MinecraftPacketIds>(header & 0x3ff);
         const auto sub_client_id = static_cast<SubClientId>((header >> 12) & 0x3);
 
+        if (!rate_limiter.tryAcquire(id, sub_client_id, packet_id, receive_buffer.size())) {
+            continue;  // Rate limited, drop the packet before it reaches any plugin or the original handler
+        }
+        if (!has_listeners) {
+            return status;
+        }
+
         endstone::core::EndstonePlayer *player = nullptr;
         if (const auto *p =
                 server.getServer().getMinecraft()->getServerNetworkHandler()->getServerPlayer(id, sub_client_id)) {
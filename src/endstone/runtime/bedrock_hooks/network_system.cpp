@@ -14,6 +14,12 @@
 
 #include "bedrock/network/network_system.h"
 
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 #include <entt/entt.hpp>
 
 #include "bedrock/network/packet.h"
@@ -25,8 +31,44 @@
 #include "endstone/core/util/socket_address.h"
 #include "endstone/event/server/packet_send_event.h"
 #include "endstone/runtime/hook.h"
+#include "endstone/runtime/vtable_hook.h"
 
 namespace {
+/**
+ * @brief Auxiliary index of NetworkSystem::connections_, mapping identifiers to slots in the vector.
+ *
+ * BDS also erases connections outside the hooked callbacks, so a slot is only trusted after checking that it still
+ * holds a connection with the same identifier. Each entry also keeps the address of its connection, resolved when
+ * the connection is opened and again if a connection with the same identifier is opened later on. Entries are removed
+ * by the close hooks only, after the original has run, so the address stays available to disconnect handlers. The
+ * index is guarded by the connections_mutex_ of its NetworkSystem.
+ */
+struct ConnectionIndex {
+    struct Entry {
+        std::size_t slot;
+        endstone::SocketAddress address;
+    };
+    std::unordered_map<NetworkIdentifier, Entry> entries;
+};
+
+ConnectionIndex &getConnectionIndex(const NetworkSystem &network)
+{
+    static std::shared_mutex mutex;
+    static std::unordered_map<const NetworkSystem *, std::unique_ptr<ConnectionIndex>> indices;
+    {
+        std::shared_lock lock(mutex);
+        if (const auto it = indices.find(&network); it != indices.end()) {
+            return *it->second;
+        }
+    }
+    std::unique_lock lock(mutex);
+    auto &index = indices[&network];
+    if (!index) {
+        index = std::make_unique<ConnectionIndex>();
+    }
+    return *index;
+}
+
 void patchPacket(const StartGamePacket &packet)
 {
     if (packet.getName() != "StartGamePacket") {
@@ -134,10 +176,12 @@ void NetworkSystem::send(const NetworkIdentifier &network_id, const Packet &pack
         stream.writeRawBytes(e.getPayload());
     }
 
-    if (auto *connection = _getConnectionFromId(network_id)) {
-        connection->last_packet_time = std::chrono::steady_clock::now();
+    auto *connection = _getConnectionFromId(network_id);
+    if (!connection) {
+        return;
     }
-    _sendInternal(network_id, packet, stream.getBuffer());
+    connection->last_packet_time = std::chrono::steady_clock::now();
+    _sendInternal(*connection, packet, stream.getBuffer());
 }
 
 void NetworkSystem::sendToMultiple(const std::vector<NetworkIdentifierWithSubId> &recipients, const Packet &packet)
@@ -149,9 +193,23 @@ void NetworkSystem::sendToMultiple(const std::vector<NetworkIdentifierWithSubId>
 
 NetworkConnection *NetworkSystem::_getConnectionFromId(const NetworkIdentifier &id) const
 {
-    for (const auto &connection : connections_) {
-        if (connection->id == id) {
-            return connection.get();
+    std::lock_guard lock(const_cast<Bedrock::Threading::RecursiveMutex &>(connections_mutex_));
+    auto &entries = getConnectionIndex(*this).entries;
+    const auto it = entries.find(id);
+    if (it != entries.end() && it->second.slot < connections_.size() && connections_[it->second.slot]->id == id) {
+        return connections_[it->second.slot].get();
+    }
+
+    // Not indexed or moved by an erase, fall back to a linear search and remember the slot
+    for (std::size_t i = 0; i < connections_.size(); ++i) {
+        if (connections_[i]->id == id) {
+            if (it != entries.end()) {
+                it->second.slot = i;
+            }
+            else {
+                entries.emplace(id, ConnectionIndex::Entry{i, endstone::core::EndstoneSocketAddress::resolve(id)});
+            }
+            return connections_[i].get();
         }
     }
     return nullptr;
@@ -159,15 +217,94 @@ NetworkConnection *NetworkSystem::_getConnectionFromId(const NetworkIdentifier &
 
 void NetworkSystem::_sendInternal(const NetworkIdentifier &id, const Packet &packet, const std::string &data)
 {
-    const auto *connection = _getConnectionFromId(id);
-    if (!connection || connection->shouldCloseConnection()) {
+    if (auto *connection = _getConnectionFromId(id)) {
+        _sendInternal(*connection, packet, data);
+    }
+}
+
+void NetworkSystem::_sendInternal(NetworkConnection &connection, const Packet &packet, const std::string &data)
+{
+    if (connection.shouldCloseConnection()) {
         return;
     }
-    if (!connection->peer) {
+    if (!connection.peer) {
         return;
     }
     if (packet_observer_) {
-        packet_observer_->packetSentTo(id, packet, data.size());
+        packet_observer_->packetSentTo(connection.id, packet, data.size());
+    }
+    connection.peer->sendPacket(data, packet.getReliability(), packet.getCompressible());
+}
+
+bool NetworkSystem::onNewIncomingConnectionHook(const NetworkIdentifier &id, std::shared_ptr<NetworkPeer> &&peer)
+{
+    const auto result =
+        ENDSTONE_VHOOK_CALL_ORIGINAL(&NetworkSystem::onNewIncomingConnectionHook, this, id, std::move(peer));
+
+    // Resolve the address once per connection rather than for every packet, outside the lock as RakNet takes its own
+    auto address = endstone::core::EndstoneSocketAddress::resolve(id);
+
+    // New connections are appended, so search from the back
+    std::lock_guard lock(connections_mutex_);
+    auto &entries = getConnectionIndex(*this).entries;
+    for (auto i = connections_.size(); i-- > 0;) {
+        if (const auto &connection = connections_[i]; connection->id == id) {
+            if (!connection->shouldCloseConnection()) {
+                entries.insert_or_assign(id, ConnectionIndex::Entry{i, std::move(address)});
+            }
+            break;
+        }
+    }
+    return result;
+}
+
+void NetworkSystem::onConnectionClosedHook(const NetworkIdentifier &id, Connection::DisconnectFailReason reason,
+                                           const std::string &message, bool skip_message)
+{
+    if (entt::locator<endstone::core::EndstoneServer>::has_value()) {
+        entt::locator<endstone::core::EndstoneServer>::value().getPacketRateLimiter().remove(id);
+    }
+    ENDSTONE_VHOOK_CALL_ORIGINAL(&NetworkSystem::onConnectionClosedHook, this, id, reason, message, skip_message);
+    // Keep the entry until the original has run, disconnect handlers may still ask for the address
+    std::lock_guard lock(connections_mutex_);
+    getConnectionIndex(*this).entries.erase(id);
+}
+
+void NetworkSystem::onAllConnectionsClosedHook(Connection::DisconnectFailReason reason, const std::string &message,
+                                               bool skip_message)
+{
+    ENDSTONE_VHOOK_CALL_ORIGINAL(&NetworkSystem::onAllConnectionsClosedHook, this, reason, message, skip_message);
+    std::lock_guard lock(connections_mutex_);
+    getConnectionIndex(*this).entries.clear();
+}
+
+void NetworkSystem::onAllRemoteConnectionsClosedHook(Connection::DisconnectFailReason reason,
+                                                     const std::string &message, bool skip_message)
+{
+    std::vector<NetworkIdentifier> closed;
+    {
+        std::lock_guard lock(connections_mutex_);
+        for (const auto &connection : connections_) {
+            if (connection->type == NetworkConnection::Type::Remote) {
+                closed.push_back(connection->id);
+            }
+        }
+    }
+    ENDSTONE_VHOOK_CALL_ORIGINAL(&NetworkSystem::onAllRemoteConnectionsClosedHook, this, reason, message,
+                                 skip_message);
+    std::lock_guard lock(connections_mutex_);
+    auto &entries = getConnectionIndex(*this).entries;
+    for (const auto &id : closed) {
+        entries.erase(id);
     }
-    connection->peer->sendPacket(data, packet.getReliability(), packet.getCompressible());
+}
+
+const endstone::SocketAddress *NetworkSystem::getSocketAddress(const NetworkIdentifier &id) const
+{
+    std::lock_guard lock(const_cast<Bedrock::Threading::RecursiveMutex &>(connections_mutex_));
+    const auto &entries = getConnectionIndex(*this).entries;
+    if (const auto it = entries.find(id); it != entries.end()) {
+        return &it->second.address;
+    }
+    return nullptr;
 }
@@ -14,43 +14,47 @@
 
 #include "bedrock/network/packet.h"
 
+#include <unordered_map>
+
 #include "endstone/core/server.h"
 #include "endstone/runtime/hook.h"
 
-class PlayerPacketHandler : public IPacketHandlerDispatcher {
+namespace {
+class EndstonePacketHandler : public IPacketHandlerDispatcher {
 public:
-    explicit PlayerPacketHandler(const IPacketHandlerDispatcher &original) : original_(original) {}
+    explicit EndstonePacketHandler(const IPacketHandlerDispatcher &original) : original_(original) {}
     void handle(const NetworkIdentifier &network_id, NetEventCallback &callback,
                 std::shared_ptr<Packet> &packet) const override
     {
         const auto &server = endstone::core::EndstoneServer::getInstance();
-        const auto network_handler = server.getServer().getMinecraft()->getServerNetworkHandler();
-        if (const auto *p = network_handler->getServerPlayer(network_id, packet->getClientSubId())) {
-            if (p->getEndstoneActor<endstone::core::EndstonePlayer>().handlePacket(*packet)) {
-                original_.handle(network_id, callback, packet);
-            }
+        if (server.getPacketHandlerRegistry().handle(network_id, *packet)) {
+            original_.handle(network_id, callback, packet);
         }
     }
 
 private:
     const IPacketHandlerDispatcher &original_;
 };
+}  // namespace
 
 std::shared_ptr<Packet> MinecraftPackets::createPacket(MinecraftPacketIds id)
 {
     auto packet = ENDSTONE_HOOK_CALL_ORIGINAL(&MinecraftPackets::createPacket, id);
-    switch (id) {
-    case MinecraftPacketIds::SetLocalPlayerAsInit:
-    case MinecraftPacketIds::PlayerAuthInputPacket: {
-        static std::unordered_map<MinecraftPacketIds, std::unique_ptr<PlayerPacketHandler>> handlers;
-        if (packet->handler_) {
-            handlers.emplace(id, std::make_unique<PlayerPacketHandler>(*packet->handler_));
-            packet->handler_ = handlers[id].get();
-        }
-        break;
+    if (!packet || !packet->handler_ || !entt::locator<endstone::core::EndstoneServer>::has_value()) {
+        return packet;
     }
-    default:
-        break;
+
+    const auto &server = endstone::core::EndstoneServer::getInstance();
+    if (!server.getPacketHandlerRegistry().hasHandlers(id)) {
+        return packet;
+    }
+
+    // The dispatchers are static instances per packet type, so we only need to wrap them once.
+    static std::unordered_map<MinecraftPacketIds, std::unique_ptr<EndstonePacketHandler>> handlers;
+    auto it = handlers.find(id);
+    if (it == handlers.end()) {
+        it = handlers.emplace(id, std::make_unique<EndstonePacketHandler>(*packet->handler_)).first;
     }
+    packet->handler_ = it->second.get();
     return packet;
 }
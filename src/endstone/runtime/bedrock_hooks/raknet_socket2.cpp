@@ -14,7 +14,9 @@
 
 #include "bedrock/deps/raknet/raknet_socket2.h"
 
-#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <entt/entt.hpp>
 
@@ -22,7 +24,6 @@
 #include "bedrock/deps/raknet/message_identifiers.h"
 #include "endstone/core/server.h"
 #include "endstone/event/server/server_list_ping_event.h"
-#include "endstone/plugin/plugin_manager.h"
 #include "endstone/runtime/hook.h"
 
 using endstone::core::EndstoneServer;
@@ -46,24 +47,40 @@ RNS2SendResult RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP(RNS2Socket so
                                            send_parameters, file, line);
     }
 
-    std::string ping_response{data + head_size + 2, strlen};
     auto &server = entt::locator<EndstoneServer>::value();
     char buffer[INET6_ADDRSTRLEN + 5 + 1] = {};
     send_parameters->system_address.ToString(false, buffer);
-    endstone::ServerListPingEvent event(std::string(buffer), send_parameters->system_address.GetPort(), ping_response);
-    if (!event.deserialize()) {
-        server.getLogger().error("Unable to parse ping response: {}", ping_response);
+    const std::string remote_host{buffer};
+    const int remote_port = send_parameters->system_address.GetPort();
+
+    auto &cache = server.getServerListPingCache();
+    if (!cache.tryAcquire(remote_host)) {
+        return send_parameters->length;  // Rate limited, drop the pong silently
+    }
+
+    const std::string_view server_response{data + head_size + 2, strlen};
+    const auto cached_response = cache.getResponse(server_response, remote_host, remote_port);
+    if (!cached_response) {
+        server.getLogger().error("Unable to parse ping response: {}", server_response);
         return ENDSTONE_HOOK_CALL_ORIGINAL(&RNS2_Windows_Linux_360::Send_Windows_Linux_360NoVDP, socket,
                                            send_parameters, file, line);
     }
 
-    server.getPluginManager().callEvent(event);
+    // Only fall back to the per-ping event when there are plugins listening to it
+    std::string_view ping_response = *cached_response;
+    std::string event_response;
+    if (auto &plugin_manager = static_cast<endstone::core::EndstonePluginManager &>(server.getPluginManager());
+        plugin_manager.hasEventHandlers(endstone::ServerListPingEvent::NAME)) {
+        endstone::ServerListPingEvent event(remote_host, remote_port, *cached_response);
+        event.deserialize();
+        plugin_manager.callEvent(event);
+        event_response = event.serialize();
+        ping_response = event_response;
+    }
 
-    std::vector<char> packet;
-    packet.reserve(256);
+    thread_local std::vector<char> packet;
+    packet.clear();
     packet.insert(packet.end(), data, data + head_size);
-
-    ping_response = event.serialize();
     strlen = ping_response.length();
     packet.push_back(static_cast<char>((strlen >> 8) & 0xFF));
     packet.push_back(static_cast<char>(strlen & 0xFF));
@@ -17,6 +17,8 @@
 #include <mutex>
 #include <thread>
 
+#include "bedrock/network/server_network_system.h"
+
 #include "bedrock/scripting/event_handlers/script_actor_gameplay_handler.h"
 #include "bedrock/scripting/event_handlers/script_block_gameplay_handler.h"
 #include "bedrock/scripting/event_handlers/script_item_gameplay_handler.h"
@@ -119,6 +121,23 @@ void hookEventHandler(ServerNetworkEventHandler &handler)
 #endif
 }
 
+void hookNetworkSystem(NetworkSystem &network)
+{
+    // Hooks RakNetConnector::ConnectionCallbacks, the primary base of NetworkSystem
+    using endstone::hook::hook_vtable;
+#ifdef _WIN32
+    hook_vtable<1>(&network, &NetworkSystem::onNewIncomingConnectionHook);
+    hook_vtable<3>(&network, &NetworkSystem::onConnectionClosedHook);
+    hook_vtable<4>(&network, &NetworkSystem::onAllConnectionsClosedHook);
+    hook_vtable<5>(&network, &NetworkSystem::onAllRemoteConnectionsClosedHook);
+#else
+    hook_vtable<2>(&network, &NetworkSystem::onNewIncomingConnectionHook);
+    hook_vtable<4>(&network, &NetworkSystem::onConnectionClosedHook);
+    hook_vtable<5>(&network, &NetworkSystem::onAllConnectionsClosedHook);
+    hook_vtable<6>(&network, &NetworkSystem::onAllRemoteConnectionsClosedHook);
+#endif
+}
+
 void ServerScriptManager::_runPlugins(PluginExecutionGroup exe_group, ServerInstance &server_instance)
 {
     ENDSTONE_HOOK_CALL_ORIGINAL(&ServerScriptManager::_runPlugins, this, exe_group, server_instance);
@@ -126,6 +145,9 @@ void ServerScriptManager::_runPlugins(PluginExecutionGroup exe_group, ServerInst
     switch (exe_group) {
     case PluginExecutionGroup::PrePackLoadExecution: {
         std::call_once(init_server, [&server_instance]() {
+            endstone::hook::begin_vtable_hooks();
+            hookNetworkSystem(server_instance.getNetwork());
+            endstone::hook::install_vtable_hooks();
             auto &server = entt::locator<endstone::core::EndstoneServer>::value_or();
             server.init(server_instance);
         });
@@ -135,6 +157,7 @@ void ServerScriptManager::_runPlugins(PluginExecutionGroup exe_group, ServerInst
         std::call_once(init_level, [&server_instance]() {
             auto &level = *server_instance.getMinecraft()->getLevel();
             auto &server = entt::locator<endstone::core::EndstoneServer>::value();
+            endstone::hook::begin_vtable_hooks();
             hookEventHandler(*level.getActorEventCoordinator().actor_gameplay_handler);
             hookEventHandler(*level.getBlockEventCoordinator().block_gameplay_handler);
             hookEventHandler(*level.getItemEventCoordinator().item_gameplay_handler);
@@ -142,6 +165,7 @@ void ServerScriptManager::_runPlugins(PluginExecutionGroup exe_group, ServerInst
             hookEventHandler(*level.getServerPlayerEventCoordinator().player_gameplay_handler);
             hookEventHandler(*level.getScriptingEventCoordinator().scripting_event_handler);
             hookEventHandler(*level.getServerNetworkEventCoordinator().server_network_event_handler);
+            endstone::hook::install_vtable_hooks();
             server.setLevel(level);
         });
         break;
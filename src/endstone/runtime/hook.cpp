@@ -16,9 +16,12 @@
 
 #include <funchook.h>
 
+#include <chrono>
 #include <string>
 #include <system_error>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include <entt/core/hashed_string.hpp>
 #include <spdlog/spdlog.h>
@@ -52,19 +55,13 @@ void *&get_original(void *target)
     return it->second;
 }
 
-const std::unordered_map<std::string, void *> &get_targets()
+void *find_target(std::string_view name)
 {
-    static std::unordered_map<std::string, void *> targets;
-    if (!targets.empty()) {
-        return targets;
+    const auto offset = detail::find_symbol(name);
+    if (!offset) {
+        return nullptr;
     }
-    auto *executable_base = detail::get_executable_base();
-    detail::foreach_symbol([executable_base](const auto &key, auto offset) {
-        SPDLOG_DEBUG("T: {} -> 0x{:x}", key, offset);
-        auto *target = static_cast<char *>(executable_base) + offset;
-        targets.emplace(key, target);
-    });
-    return targets;
+    return static_cast<char *>(detail::get_executable_base()) + *offset;
 }
 
 const std::error_category &error_category()
@@ -116,32 +113,56 @@ const std::error_category &error_category()
 
 void install()
 {
+    using std::chrono::steady_clock;
+    const auto elapsed_ms = [](auto from, auto to) {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    };
+
+    const auto start = steady_clock::now();
     const auto &detours = details::get_detours();
-    const auto &targets = details::get_targets();
+    const auto detours_loaded = steady_clock::now();
 
+    // Resolve only the targets we detour
+    std::vector<std::tuple<const std::string *, void *, void *>> hooks;  // name, target, detour
+    hooks.reserve(detours.size());
     for (const auto &[name, detour] : detours) {
-        if (auto it = targets.find(name); it != targets.end()) {
-            void *target = it->second;
-            void *original = target;
-
-            funchook_t *hook = funchook_create();
-            int status = funchook_prepare(hook, &original, detour);
-            if (status != 0) {
-                throw std::system_error(status, details::error_category(), fmt::format("Unable to hook {}", name));
-            }
-
-            status = funchook_install(hook, 0);
-            if (status != 0) {
-                throw std::system_error(status, details::error_category(), fmt::format("Unable to hook {}", name));
-            }
-
-            SPDLOG_DEBUG("{}: {} -> {} -> {}", name, target, detour, original);
-            details::originals().emplace(target, original);
-        }
-        else {
+        void *target = details::find_target(name);
+        if (!target) {
             throw std::runtime_error(fmt::format("Unable to find target function for detour: {}.", name));
         }
+        hooks.emplace_back(&name, target, detour);
     }
+    const auto targets_resolved = steady_clock::now();
+
+    // Prepare every detour into a single funchook instance so that they are installed in one batch
+    funchook_t *funchook = funchook_create();
+    if (!funchook) {
+        throw std::runtime_error("Unable to create funchook instance.");
+    }
+    for (const auto &[name, target, detour] : hooks) {
+        void *original = target;
+        const int status = funchook_prepare(funchook, &original, detour);
+        if (status != 0) {
+            throw std::system_error(status, details::error_category(),
+                                    fmt::format("Unable to hook {}: {}", *name, funchook_error_message(funchook)));
+        }
+        SPDLOG_DEBUG("{}: {} -> {} -> {}", *name, target, detour, original);
+        details::originals().emplace(target, original);
+    }
+    const auto prepared = steady_clock::now();
+
+    const int status = funchook_install(funchook, 0);
+    if (status != 0) {
+        throw std::system_error(status, details::error_category(),
+                                fmt::format("Unable to install hooks: {}", funchook_error_message(funchook)));
+    }
+    const auto installed = steady_clock::now();
+
+    spdlog::debug("Installed {} hooks in {:.2f} ms (detours: {:.2f} ms, targets: {:.2f} ms, prepare: {:.2f} ms, "
+                  "install: {:.2f} ms)",
+                  hooks.size(), elapsed_ms(start, installed), elapsed_ms(start, detours_loaded),
+                  elapsed_ms(detours_loaded, targets_resolved), elapsed_ms(targets_resolved, prepared),
+                  elapsed_ms(prepared, installed));
 }
 
 }  // namespace endstone::hook
@@ -19,13 +19,14 @@
 #include <entt/entt.hpp>
 
 #include "bedrock/symbol.h"
+#include "endstone/core/util/hook_stats.h"
 #include "endstone/detail/cast.h"
 
 namespace endstone::hook {
 namespace details {
 const std::error_category &error_category();
 void *&get_original(void *target);
-const std::unordered_map<std::string, void *> &get_targets();
+void *find_target(std::string_view name);
 const std::unordered_map<std::string, void *> &get_detours();
 }  // namespace details
 
@@ -42,6 +43,8 @@ void *get_original()
 }  // namespace endstone::hook
 
 #define ENDSTONE_HOOK_CALL_ORIGINAL(fp, ...) ENDSTONE_HOOK_CALL_ORIGINAL_NAME(fp, __FUNCDNAME__, ##__VA_ARGS__)
-#define ENDSTONE_HOOK_CALL_ORIGINAL_NAME(fp, name, ...)                                                            \
-    std::invoke(endstone::detail::fp_cast(fp, endstone::hook::get_original<endstone::detail::get_symbol(name)>()), \
-                ##__VA_ARGS__)
+#define ENDSTONE_HOOK_CALL_ORIGINAL_NAME(fp, name, ...)                                                    \
+    endstone::core::HookProfiler::invoke(                                                                  \
+        endstone::core::get_hook_counter<endstone::detail::get_symbol(name)>(#fp),                         \
+        endstone::detail::fp_cast(fp, endstone::hook::get_original<endstone::detail::get_symbol(name)>()), \
+        ##__VA_ARGS__)
@@ -27,35 +27,77 @@ static OriginalMap &originals()  // NOLINT(*-use-anonymous-namespace)
     return originals;
 }
 
-void hook_vtable(void **vtable, int ordinal, void *detour)
+static funchook_t *&pending()  // NOLINT(*-use-anonymous-namespace)
 {
-    // Get the function pointer at the specified ordinal.
-    void *target = vtable[ordinal];
+    static funchook_t *funchook = nullptr;
+    return funchook;
+}
 
-    // Create a funchook instance.
+static funchook_t *create()  // NOLINT(*-use-anonymous-namespace)
+{
     funchook_t *funchook = funchook_create();
     if (!funchook) {
         fprintf(stderr, "Failed to create funchook instance\n");
         exit(EXIT_FAILURE);
     }
+    return funchook;
+}
 
-    // Prepare the hook: provide the address of the target pointer and the detour.
-    int status = funchook_prepare(funchook, &target, detour);
+static void install(funchook_t *funchook)  // NOLINT(*-use-anonymous-namespace)
+{
+    const int status = funchook_install(funchook, 0);
     if (status != 0) {
-        fprintf(stderr, "Error in funchook_prepare: %s\n", funchook_error_message(funchook));
+        fprintf(stderr, "Error in funchook_install: %s\n", funchook_error_message(funchook));
         exit(EXIT_FAILURE);
     }
+}
+
+void hook_vtable(void **vtable, int ordinal, void *detour)
+{
+    // Get the function pointer at the specified ordinal.
+    void *target = vtable[ordinal];
+
+    // Inside a batch the hook is only prepared, otherwise it is installed right away.
+    funchook_t *funchook = pending();
+    const bool batched = funchook != nullptr;
+    if (!batched) {
+        funchook = create();
+    }
 
-    // Install the hook.
-    status = funchook_install(funchook, 0);
+    // Prepare the hook: provide the address of the target pointer and the detour.
+    const int status = funchook_prepare(funchook, &target, detour);
     if (status != 0) {
-        fprintf(stderr, "Error in funchook_install: %s\n", funchook_error_message(funchook));
+        fprintf(stderr, "Error in funchook_prepare: %s\n", funchook_error_message(funchook));
         exit(EXIT_FAILURE);
     }
     originals()[detour] = target;
+
+    if (!batched) {
+        install(funchook);
+    }
 }
 }  // namespace details
 
+void begin_vtable_hooks()
+{
+    funchook_t *&funchook = details::pending();
+    if (!funchook) {
+        funchook = details::create();
+    }
+}
+
+void install_vtable_hooks()
+{
+    funchook_t *&funchook = details::pending();
+    if (!funchook) {
+        return;
+    }
+
+    // Install all prepared hooks in one go.
+    details::install(funchook);
+    funchook = nullptr;
+}
+
 void *get_vtable_original(void *detour)
 {
     const auto it = details::originals().find(detour);
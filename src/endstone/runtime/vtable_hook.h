@@ -14,8 +14,7 @@
 
 #pragma once
 
-#include <mutex>
-
+#include "endstone/core/util/hook_stats.h"
 #include "endstone/detail/cast.h"
 
 namespace endstone::hook {
@@ -30,9 +29,32 @@ void hook_vtable(Obj *obj, Detour detour)
     details::hook_vtable(vtable, Ordinal, detail::fp_cast(detour));
 }
 
+/**
+ * @brief Starts a batch of vtable hooks.
+ *
+ * Until install_vtable_hooks is called, hook_vtable only prepares the hooks. Outside a batch, hook_vtable installs
+ * each hook immediately.
+ */
+void begin_vtable_hooks();
+
+/**
+ * @brief Installs every vtable hook prepared since begin_vtable_hooks in a single batch and ends the batch.
+ */
+void install_vtable_hooks();
 void *get_vtable_original(void *detour);
+
+template <auto Detour>
+void *get_vtable_original()
+{
+    static void *original = nullptr;
+    if (!original) {
+        original = get_vtable_original(detail::fp_cast(Detour));
+    }
+    return original;
+}
 }  // namespace endstone::hook
 
-#define ENDSTONE_VHOOK_CALL_ORIGINAL(fp, ...)                                                               \
-    std::invoke(endstone::detail::fp_cast(fp, endstone::hook::get_vtable_original(endstone::detail::fp_cast(fp))), \
-                ##__VA_ARGS__)
+#define ENDSTONE_VHOOK_CALL_ORIGINAL(fp, ...)                                                                     \
+    endstone::core::HookProfiler::invoke(endstone::core::get_hook_counter<fp>(#fp),                               \
+                                         endstone::detail::fp_cast(fp, endstone::hook::get_vtable_original<fp>()), \
+                                         ##__VA_ARGS__)
@@ -69,6 +69,10 @@ public:
                 (std::string, endstone::BlockStates), (const, override));
     MOCK_METHOD(endstone::PlayerBanList &, getBanList, (), (const, override));
     MOCK_METHOD(endstone::IpBanList &, getIpBanList, (), (const, override));
+    MOCK_METHOD(void, setServerListPingOverride,
+                (endstone::Plugin &, std::string, std::function<void(endstone::ServerListPingEvent &)>), (override));
+    MOCK_METHOD(void, removeServerListPingOverride, (endstone::Plugin &, std::string), (override));
+    MOCK_METHOD(void, removeServerListPingOverrides, (endstone::Plugin &), (override));
 };
 
 class MockPlugin : public endstone::Plugin {
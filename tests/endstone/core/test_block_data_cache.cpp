@@ -0,0 +1,105 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/block/block_data_cache.h"
+
+namespace endstone::core {
+
+class BlockDataCacheTest : public ::testing::Test {
+protected:
+    static const ::Block *fakeBlock(int &storage)
+    {
+        return reinterpret_cast<const ::Block *>(&storage);
+    }
+
+    BlockDataCache cache_;
+};
+
+TEST_F(BlockDataCacheTest, KeyIgnoresStateOrder)
+{
+    BlockStates a{{"color", std::string("red")}, {"facing", 2}, {"open", true}};
+    BlockStates b;
+    b.emplace("open", true);
+    b.emplace("facing", 2);
+    b.emplace("color", std::string("red"));
+    EXPECT_EQ(BlockDataCache::makeKey("minecraft:wool", a), BlockDataCache::makeKey("minecraft:wool", b));
+}
+
+TEST_F(BlockDataCacheTest, KeyDistinguishesValueTypes)
+{
+    const auto as_int = BlockDataCache::makeKey("minecraft:stone", {{"state", 1}});
+    const auto as_string = BlockDataCache::makeKey("minecraft:stone", {{"state", std::string("1")}});
+    const auto as_bool = BlockDataCache::makeKey("minecraft:stone", {{"state", true}});
+    EXPECT_NE(as_int, as_string);
+    EXPECT_NE(as_int, as_bool);
+    EXPECT_NE(as_string, as_bool);
+    EXPECT_NE(BlockDataCache::makeKey("minecraft:stone", {}), as_int);
+}
+
+TEST_F(BlockDataCacheTest, ResolvesOnce)
+{
+    int storage = 0;
+    int calls = 0;
+    const auto key = BlockDataCache::makeKey("minecraft:stone", {});
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(cache_.get(key,
+                             [&]() {
+                                 ++calls;
+                                 return fakeBlock(storage);
+                             }),
+                  fakeBlock(storage));
+    }
+    EXPECT_EQ(calls, 1);
+
+    const auto stats = cache_.getStats();
+    EXPECT_EQ(stats.size, 1);
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 1);
+}
+
+TEST_F(BlockDataCacheTest, UnknownBlocksAreNotCached)
+{
+    int calls = 0;
+    const auto key = BlockDataCache::makeKey("minecraft:unknown", {});
+    for (int i = 0; i < 2; ++i) {
+        EXPECT_EQ(cache_.get(key,
+                             [&]() -> const ::Block * {
+                                 ++calls;
+                                 return nullptr;
+                             }),
+                  nullptr);
+    }
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(cache_.getStats().size, 0);
+}
+
+TEST_F(BlockDataCacheTest, ClearInvalidatesEntries)
+{
+    int storage = 0;
+    int calls = 0;
+    const auto key = BlockDataCache::makeKey("minecraft:stone", {});
+    auto resolve = [&]() {
+        ++calls;
+        return fakeBlock(storage);
+    };
+    cache_.get(key, resolve);
+    cache_.clear();
+    EXPECT_EQ(cache_.getStats().size, 0);
+    cache_.get(key, resolve);
+    EXPECT_EQ(calls, 2);
+}
+
+}  // namespace endstone::core
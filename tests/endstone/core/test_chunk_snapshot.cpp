@@ -0,0 +1,95 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "endstone/level/chunk_snapshot.h"
+
+using endstone::ChunkSnapshot;
+
+class ChunkSnapshotTest : public ::testing::Test {
+protected:
+    static constexpr int MinHeight = -64;
+    static constexpr std::uint32_t Stone = 1;
+    static constexpr std::uint32_t Dirt = 2;
+    static constexpr std::uint32_t Air = 3;
+
+    // The bottom section is all stone. The one above is air except for a single dirt block at (3, -41, 5)
+    ChunkSnapshot snapshot_ = [] {
+        ChunkSnapshot::Section stone{{Stone}, {}};
+        ChunkSnapshot::Section mixed{{Air, Dirt}, {}};
+        for (int x = 0; x < ChunkSnapshot::SectionSize; ++x) {
+            for (int z = 0; z < ChunkSnapshot::SectionSize; ++z) {
+                for (int y = 0; y < ChunkSnapshot::SectionSize; ++y) {
+                    mixed.indices.push_back(x == 3 && y == 7 && z == 5 ? 1 : 0);
+                }
+            }
+        }
+        std::array<int, ChunkSnapshot::SectionSize * ChunkSnapshot::SectionSize> height_map{};
+        height_map.fill(MinHeight + ChunkSnapshot::SectionSize - 1);
+        height_map[3 * ChunkSnapshot::SectionSize + 5] = -41;
+        return ChunkSnapshot("overworld", 2, -3, MinHeight, {stone, mixed}, height_map);
+    }();
+};
+
+TEST_F(ChunkSnapshotTest, Bounds)
+{
+    EXPECT_EQ(snapshot_.getDimensionName(), "overworld");
+    EXPECT_EQ(snapshot_.getX(), 2);
+    EXPECT_EQ(snapshot_.getZ(), -3);
+    EXPECT_EQ(snapshot_.getMinHeight(), -64);
+    EXPECT_EQ(snapshot_.getMaxHeight(), -32);
+    EXPECT_TRUE(snapshot_.contains(0, -64, 0));
+    EXPECT_TRUE(snapshot_.contains(15, -33, 15));
+    EXPECT_FALSE(snapshot_.contains(0, -32, 0));
+}
+
+TEST_F(ChunkSnapshotTest, SinglePaletteSection)
+{
+    EXPECT_EQ(snapshot_.getRuntimeId(0, -64, 0), Stone);
+    EXPECT_EQ(snapshot_.getRuntimeId(15, -49, 15), Stone);
+    EXPECT_EQ(snapshot_.getRuntimeId(3, -57, 5), Stone);
+}
+
+TEST_F(ChunkSnapshotTest, IndicesAreOrderedXZY)
+{
+    EXPECT_EQ(snapshot_.getRuntimeId(3, -41, 5), Dirt);
+
+    // the same local coordinates in any other order must miss the block
+    EXPECT_EQ(snapshot_.getRuntimeId(5, -41, 3), Air);
+    EXPECT_EQ(snapshot_.getRuntimeId(3, -43, 7), Air);
+    EXPECT_EQ(snapshot_.getRuntimeId(7, -45, 5), Air);
+    EXPECT_EQ(snapshot_.getRuntimeId(5, -45, 7), Air);
+    EXPECT_EQ(snapshot_.getRuntimeId(3, -40, 5), Air);
+}
+
+TEST_F(ChunkSnapshotTest, HighestBlockY)
+{
+    EXPECT_EQ(snapshot_.getHighestBlockYAt(3, 5), -41);
+    EXPECT_EQ(snapshot_.getHighestBlockYAt(5, 3), -49);
+}
+
+TEST_F(ChunkSnapshotTest, OutOfRange)
+{
+    EXPECT_THROW((void)snapshot_.getRuntimeId(-1, -64, 0), std::out_of_range);
+    EXPECT_THROW((void)snapshot_.getRuntimeId(16, -64, 0), std::out_of_range);
+    EXPECT_THROW((void)snapshot_.getRuntimeId(0, -64, -1), std::out_of_range);
+    EXPECT_THROW((void)snapshot_.getRuntimeId(0, -64, 16), std::out_of_range);
+    EXPECT_THROW((void)snapshot_.getRuntimeId(0, -65, 0), std::out_of_range);
+    EXPECT_THROW((void)snapshot_.getRuntimeId(0, -32, 0), std::out_of_range);
+    EXPECT_THROW((void)snapshot_.getHighestBlockYAt(-1, 0), std::out_of_range);
+    EXPECT_THROW((void)snapshot_.getHighestBlockYAt(0, 16), std::out_of_range);
+}
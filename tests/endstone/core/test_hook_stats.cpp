@@ -0,0 +1,217 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/util/hook_stats.h"
+
+using endstone::core::HookCounter;
+using endstone::core::HookProfiler;
+using endstone::core::HookStats;
+
+namespace {
+const HookStats::Entry *findEntry(const std::vector<HookStats::Entry> &entries, std::string_view name)
+{
+    for (const auto &entry : entries) {
+        if (entry.name == name) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+}  // namespace
+
+class HookStatsTest : public ::testing::Test {
+protected:
+    // Counters and the profiler are process-wide, so every test starts from a clean slate
+    void SetUp() override
+    {
+        HookProfiler::disable();
+        HookStats::reset();
+    }
+
+    void TearDown() override
+    {
+        HookProfiler::disable();
+    }
+};
+
+TEST_F(HookStatsTest, CountsCalls)
+{
+    static HookCounter counter("HookStatsTest::CountsCalls");
+    for (int i = 0; i < 10; ++i) {
+        counter.increment();
+    }
+
+    const auto entries = HookStats::getEntries();
+    const auto *entry = findEntry(entries, "HookStatsTest::CountsCalls");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->calls, 10);
+}
+
+TEST_F(HookStatsTest, SortsByCalls)
+{
+    static HookCounter rare("HookStatsTest::Rare");
+    static HookCounter frequent("HookStatsTest::Frequent");
+    rare.increment();
+    for (int i = 0; i < 5; ++i) {
+        frequent.increment();
+    }
+
+    const auto entries = HookStats::getEntries();
+    const auto *rare_entry = findEntry(entries, "HookStatsTest::Rare");
+    const auto *frequent_entry = findEntry(entries, "HookStatsTest::Frequent");
+    ASSERT_NE(rare_entry, nullptr);
+    ASSERT_NE(frequent_entry, nullptr);
+    EXPECT_LT(frequent_entry, rare_entry);
+}
+
+TEST_F(HookStatsTest, Reset)
+{
+    static HookCounter counter("HookStatsTest::Reset");
+    counter.increment();
+    HookStats::reset();
+    EXPECT_EQ(counter.getCalls(), 0);
+    EXPECT_EQ(findEntry(HookStats::getEntries(), "HookStatsTest::Reset"), nullptr);
+}
+
+TEST_F(HookStatsTest, ConcurrentIncrements)
+{
+    static HookCounter counter("HookStatsTest::ConcurrentIncrements");
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([] {
+            for (int j = 0; j < 10000; ++j) {
+                counter.increment();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.getCalls(), 40000);
+}
+
+TEST_F(HookStatsTest, ProfilerDisabledOnlyCounts)
+{
+    static HookCounter counter("HookStatsTest::ProfilerDisabledOnlyCounts");
+    EXPECT_EQ(HookProfiler::invoke(counter, [](int a, int b) { return a + b; }, 1, 2), 3);
+
+    const auto *entry = findEntry(HookStats::getEntries(), "HookStatsTest::ProfilerDisabledOnlyCounts");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->calls, 1);
+    EXPECT_EQ(entry->profile.samples, 0);
+}
+
+TEST_F(HookStatsTest, ProfilerAttributesDispatch)
+{
+    static HookCounter outer("HookStatsTest::Outer");
+    static HookCounter inner("HookStatsTest::Inner");
+    HookProfiler::enable();
+
+    // outer detour fires an event, then calls its original, which runs through an inner hook that fires another
+    HookProfiler::recordDispatch(std::chrono::milliseconds(2));
+    HookProfiler::invoke(outer, [] {
+        HookProfiler::recordDispatch(std::chrono::milliseconds(3));
+        HookProfiler::invoke(inner, [] { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+    });
+    HookProfiler::disable();
+
+    const auto entries = HookStats::getEntries();
+    const auto *outer_entry = findEntry(entries, "HookStatsTest::Outer");
+    const auto *inner_entry = findEntry(entries, "HookStatsTest::Inner");
+    ASSERT_NE(outer_entry, nullptr);
+    ASSERT_NE(inner_entry, nullptr);
+    EXPECT_EQ(outer_entry->profile.samples, 1);
+    EXPECT_EQ(outer_entry->profile.dispatch_ns, 2000000);
+    EXPECT_EQ(inner_entry->profile.samples, 1);
+    EXPECT_EQ(inner_entry->profile.dispatch_ns, 3000000);
+    EXPECT_GE(inner_entry->profile.original_ns, 1000000);
+}
+
+TEST_F(HookStatsTest, ProfilerSamplesEveryNthCall)
+{
+    static HookCounter counter("HookStatsTest::ProfilerSamplesEveryNthCall");
+    HookProfiler::enable(4);
+    for (int i = 0; i < 16; ++i) {
+        HookProfiler::invoke(counter, [] {});
+    }
+    HookProfiler::disable();
+
+    const auto *entry = findEntry(HookStats::getEntries(), "HookStatsTest::ProfilerSamplesEveryNthCall");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->calls, 16);
+    EXPECT_EQ(entry->profile.samples, 4);
+}
+
+TEST_F(HookStatsTest, ProfilerDiscardsDispatchOfUnsampledCalls)
+{
+    static HookCounter counter("HookStatsTest::ProfilerDiscardsDispatchOfUnsampledCalls");
+    HookProfiler::enable(4);
+    for (int i = 0; i < 16; ++i) {
+        HookProfiler::recordDispatch(std::chrono::milliseconds(1));
+        HookProfiler::invoke(counter, [] { HookProfiler::recordDispatch(std::chrono::milliseconds(1)); });
+    }
+    HookProfiler::disable();
+
+    const auto *entry = findEntry(HookStats::getEntries(), "HookStatsTest::ProfilerDiscardsDispatchOfUnsampledCalls");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->profile.samples, 4);
+    EXPECT_EQ(entry->profile.dispatch_ns, 8000000);
+}
+
+// The original of a vtable hook is cached in a function-local static after the first map lookup, see
+// get_vtable_original. Reading the cached pointer must stay cheaper than the map lookup it replaced.
+TEST_F(HookStatsTest, CachedOriginalBeatsMapLookup)
+{
+    constexpr int iterations = 1000000;
+    std::unordered_map<void *, void *> originals;
+    std::vector<int> targets(64);
+    for (auto &target : targets) {
+        originals.emplace(&target, &target);
+    }
+    void *volatile detour = &targets[targets.size() / 2];
+    void *volatile sink = nullptr;
+
+    // the best of a few rounds, so that a single preemption does not decide the outcome
+    auto map_lookup = std::chrono::steady_clock::duration::max();
+    auto cached = std::chrono::steady_clock::duration::max();
+    for (int round = 0; round < 5; ++round) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            sink = originals.find(static_cast<void *>(detour))->second;
+        }
+        map_lookup = std::min(map_lookup, std::chrono::steady_clock::now() - start);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            static void *original = nullptr;
+            if (!original) {
+                original = originals.find(static_cast<void *>(detour))->second;
+            }
+            sink = original;
+        }
+        cached = std::min(cached, std::chrono::steady_clock::now() - start);
+    }
+
+    EXPECT_EQ(sink, detour);
+    EXPECT_LT(cached, map_lookup);
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "endstone/core/network/packet_rate_limiter.h"
+
+using endstone::core::PacketRateLimiter;
+
+namespace {
+NetworkIdentifier createNetworkId(std::uint64_t guid)
+{
+    NetworkIdentifier network_id{};
+    network_id.type = NetworkIdentifier::Type::RakNet;
+    network_id.guid.g = guid;
+    return network_id;
+}
+}  // namespace
+
+TEST(PacketRateLimiterTest, PacketClasses)
+{
+    ASSERT_EQ(PacketRateLimiter::getPacketClass(MinecraftPacketIds::PlayerAuthInputPacket),
+              PacketRateLimiter::PacketClass::Movement);
+    ASSERT_EQ(PacketRateLimiter::getPacketClass(MinecraftPacketIds::Text), PacketRateLimiter::PacketClass::Chat);
+    ASSERT_EQ(PacketRateLimiter::getPacketClass(MinecraftPacketIds::Animate), PacketRateLimiter::PacketClass::Other);
+}
+
+TEST(PacketRateLimiterTest, DropsPacketsAboveLimit)
+{
+    PacketRateLimiter limiter({0, 2, 0});
+    ASSERT_TRUE(limiter.isEnabled());
+
+    const auto player = createNetworkId(1);
+    ASSERT_TRUE(limiter.tryAcquire(player, SubClientId::PrimaryClient, MinecraftPacketIds::Text, 10));
+    ASSERT_TRUE(limiter.tryAcquire(player, SubClientId::PrimaryClient, MinecraftPacketIds::Text, 10));
+    ASSERT_FALSE(limiter.tryAcquire(player, SubClientId::PrimaryClient, MinecraftPacketIds::Text, 10));
+    ASSERT_FALSE(limiter.tryAcquire(player, SubClientId::PrimaryClient, MinecraftPacketIds::CommandRequest, 15));
+
+    // Other packet classes and other connections have their own buckets
+    ASSERT_TRUE(limiter.tryAcquire(player, SubClientId::PrimaryClient, MinecraftPacketIds::PlayerAuthInputPacket, 100));
+    ASSERT_TRUE(limiter.tryAcquire(createNetworkId(2), SubClientId::PrimaryClient, MinecraftPacketIds::Text, 10));
+
+    const auto stats = limiter.getStats(player, SubClientId::PrimaryClient);
+    ASSERT_EQ(stats.dropped_packets, 2U);
+    ASSERT_EQ(stats.dropped_bytes, 25U);
+
+    limiter.remove(player);
+    ASSERT_EQ(limiter.getStats(player, SubClientId::PrimaryClient).dropped_packets, 0U);
+}
+
+TEST(PacketRateLimiterTest, SubClientsHaveTheirOwnBuckets)
+{
+    PacketRateLimiter limiter({0, 1, 0});
+    const auto connection = createNetworkId(1);
+    ASSERT_TRUE(limiter.tryAcquire(connection, SubClientId::PrimaryClient, MinecraftPacketIds::Text, 10));
+    ASSERT_FALSE(limiter.tryAcquire(connection, SubClientId::PrimaryClient, MinecraftPacketIds::Text, 10));
+    ASSERT_TRUE(limiter.tryAcquire(connection, SubClientId::Client2, MinecraftPacketIds::Text, 10));
+
+    ASSERT_EQ(limiter.getStats(connection, SubClientId::PrimaryClient).dropped_packets, 1U);
+    ASSERT_EQ(limiter.getStats(connection, SubClientId::Client2).dropped_packets, 0U);
+}
+
+TEST(PacketRateLimiterTest, AllowsBursts)
+{
+    PacketRateLimiter limiter({20, 0, 0}, 3.0);
+    const auto player = createNetworkId(1);
+    for (int i = 0; i < 60; ++i) {
+        ASSERT_TRUE(limiter.tryAcquire(player, SubClientId::PrimaryClient, MinecraftPacketIds::MovePlayer, 10));
+    }
+    ASSERT_FALSE(limiter.tryAcquire(player, SubClientId::PrimaryClient, MinecraftPacketIds::MovePlayer, 10));
+}
+
+TEST(PacketRateLimiterTest, Disabled)
+{
+    PacketRateLimiter limiter({0, 0, 0});
+    ASSERT_FALSE(limiter.isEnabled());
+    const auto player = createNetworkId(1);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(limiter.tryAcquire(player, SubClientId::PrimaryClient, MinecraftPacketIds::Text, 10));
+    }
+}
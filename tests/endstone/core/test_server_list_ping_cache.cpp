@@ -0,0 +1,126 @@
+// Copyright (c) 2024, The Endstone Project. (https://endstone.dev) All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "endstone/core/network/server_list_ping_cache.h"
+#include "mocks.h"
+
+using endstone::ServerListPingEvent;
+using endstone::core::ServerListPingCache;
+
+namespace {
+const std::string ServerResponse = "MCPE;Dedicated Server;800;1.21.92;0;10;12345;Bedrock level;Survival;1;19132;19133;0;";
+}
+
+TEST(ServerListPingCacheTest, ReusesResponseUntilServerResponseChanges)
+{
+    ServerListPingCache cache(0);
+    const auto first = cache.getResponse(ServerResponse, "127.0.0.1", 1234);
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(first, cache.getResponse(ServerResponse, "127.0.0.2", 1234));
+
+    const std::string updated = "MCPE;Dedicated Server;800;1.21.92;1;10;12345;Bedrock level;Survival;1;19132;19133;0;";
+    const auto second = cache.getResponse(updated, "127.0.0.1", 1234);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(first, second);
+    ASSERT_NE(second->find(";1;10;"), std::string::npos);
+}
+
+TEST(ServerListPingCacheTest, InvalidServerResponse)
+{
+    ServerListPingCache cache(0);
+    ASSERT_EQ(cache.getResponse("MCPE;invalid", "127.0.0.1", 1234), nullptr);
+}
+
+TEST(ServerListPingCacheTest, AppliesOverrides)
+{
+    ServerListPingCache cache(0);
+    MockPlugin plugin;
+    int calls = 0;
+    cache.setOverride(plugin, "", [&](ServerListPingEvent &event) {
+        ++calls;
+        event.setMotd("Default");
+    });
+    cache.setOverride(plugin, "127.0.0.2", [](ServerListPingEvent &event) { event.setLevelName("Special"); });
+
+    const auto response = cache.getResponse(ServerResponse, "127.0.0.1", 1234);
+    ASSERT_NE(response, nullptr);
+    ASSERT_NE(response->find(";Default;"), std::string::npos);
+    ASSERT_NE(response->find(";Bedrock level;"), std::string::npos);
+
+    const auto special = cache.getResponse(ServerResponse, "127.0.0.2", 1234);
+    ASSERT_NE(special, nullptr);
+    ASSERT_NE(special->find(";Default;"), std::string::npos);
+    ASSERT_NE(special->find(";Special;"), std::string::npos);
+
+    // Cached responses should not invoke the overrides again
+    const auto calls_before = calls;
+    ASSERT_EQ(response, cache.getResponse(ServerResponse, "127.0.0.3", 1234));
+    ASSERT_EQ(special, cache.getResponse(ServerResponse, "127.0.0.2", 1234));
+    ASSERT_EQ(calls, calls_before);
+
+    cache.removeOverride(plugin, "127.0.0.2");
+    const auto removed = cache.getResponse(ServerResponse, "127.0.0.2", 1234);
+    ASSERT_NE(removed, nullptr);
+    ASSERT_EQ(removed->find(";Special;"), std::string::npos);
+}
+
+TEST(ServerListPingCacheTest, RemovesOverridesOfPlugin)
+{
+    ServerListPingCache cache(0);
+    MockPlugin plugin, other;
+    cache.setOverride(plugin, "", [](ServerListPingEvent &event) { event.setMotd("Default"); });
+    cache.setOverride(other, "127.0.0.2", [](ServerListPingEvent &event) { event.setLevelName("Special"); });
+    ASSERT_NE(cache.getResponse(ServerResponse, "127.0.0.1", 1234)->find(";Default;"), std::string::npos);
+
+    // Overrides can only be removed by the plugin that set them
+    cache.removeOverride(other, "");
+    ASSERT_NE(cache.getResponse(ServerResponse, "127.0.0.1", 1234)->find(";Default;"), std::string::npos);
+
+    cache.removeOverrides(plugin);
+    ASSERT_EQ(cache.getResponse(ServerResponse, "127.0.0.1", 1234)->find(";Default;"), std::string::npos);
+    ASSERT_NE(cache.getResponse(ServerResponse, "127.0.0.2", 1234)->find(";Special;"), std::string::npos);
+}
+
+TEST(ServerListPingCacheTest, RateLimit)
+{
+    ServerListPingCache cache(2);
+    ASSERT_TRUE(cache.tryAcquire("127.0.0.1"));
+    ASSERT_TRUE(cache.tryAcquire("127.0.0.1"));
+    ASSERT_FALSE(cache.tryAcquire("127.0.0.1"));
+    ASSERT_TRUE(cache.tryAcquire("127.0.0.2"));
+}
+
+TEST(ServerListPingCacheTest, NoRateLimit)
+{
+    ServerListPingCache cache(0);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(cache.tryAcquire("127.0.0.1"));
+    }
+}
+
+TEST(ServerListPingCacheTest, RejectsNewHostsWhenFull)
+{
+    ServerListPingCache cache(1);
+    for (std::size_t i = 0; i < ServerListPingCache::MaxBuckets; ++i) {
+        ASSERT_TRUE(cache.tryAcquire("10.0." + std::to_string(i)));
+    }
+    // All tracked hosts are still active, so new hosts are rejected without evicting anyone
+    ASSERT_FALSE(cache.tryAcquire("127.0.0.1"));
+    ASSERT_FALSE(cache.tryAcquire("10.0.0"));
+}
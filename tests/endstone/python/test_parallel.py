@@ -0,0 +1,104 @@
+import asyncio
+import math
+import os
+import time
+
+import pytest
+
+from endstone._internal import event_loop
+from endstone._internal.parallel import (
+    ExecutionMode,
+    _is_free_threaded,
+    get_execution_mode,
+    run_parallel,
+    share,
+    shutdown_executors,
+)
+
+
+@pytest.fixture
+def loop():
+    loop = asyncio.new_event_loop()
+    event_loop._loop = loop
+    yield loop
+    shutdown_executors()
+    event_loop._loop = None
+    loop.close()
+
+
+def test_share():
+    value = {"a": [1, 2.0, b"x", bytearray(b"y")], "b": {3}}
+    assert share(value) == (("a", (1, 2.0, b"x", b"y")), ("b", frozenset({3})))
+
+    with pytest.raises(TypeError):
+        share(object())
+
+
+def test_execution_mode_thread_is_always_available():
+    assert get_execution_mode(ExecutionMode.THREAD) is ExecutionMode.THREAD
+
+
+def test_auto_never_picks_subinterpreters():
+    assert get_execution_mode(ExecutionMode.AUTO) in (ExecutionMode.THREAD, ExecutionMode.FREE_THREADED)
+
+
+def test_auto_is_thread_with_gil():
+    if _is_free_threaded():
+        pytest.skip("The running interpreter is a free-threaded build")
+
+    assert get_execution_mode(ExecutionMode.AUTO) is ExecutionMode.THREAD
+
+
+def test_run_parallel(loop):
+    result = loop.run_until_complete(run_parallel(math.factorial, 10, mode=ExecutionMode.THREAD))
+    assert result == 3628800
+
+
+def test_run_parallel_passes_arguments_unchanged(loop):
+    value = {"a": [1, 2]}
+    result = loop.run_until_complete(run_parallel(lambda arg: arg, value, mode=ExecutionMode.THREAD))
+    assert result is value
+
+
+def test_run_parallel_subinterpreter(loop):
+    try:
+        mode = get_execution_mode(ExecutionMode.SUBINTERPRETER)
+    except RuntimeError:
+        pytest.skip("Sub-interpreters with their own GIL are not available")
+
+    result = loop.run_until_complete(run_parallel(len, [1, 2, 3], mode=mode))
+    assert result == 3
+
+
+def test_run_parallel_benchmark(loop):
+    workers = min(os.cpu_count() or 1, 4)
+    if workers < 2:
+        pytest.skip("Needs at least two cores")
+
+    mode = None
+    for candidate in (ExecutionMode.FREE_THREADED, ExecutionMode.SUBINTERPRETER):
+        try:
+            mode = get_execution_mode(candidate)
+            break
+        except RuntimeError:
+            continue
+    if mode is None:
+        pytest.skip("Neither free-threading nor sub-interpreters with their own GIL are available")
+
+    async def run_all(n):
+        return await asyncio.gather(*(run_parallel(math.factorial, n, mode=mode) for _ in range(workers)))
+
+    # start the workers up front so that their startup is not measured
+    loop.run_until_complete(run_all(10))
+
+    n = 50_000
+    start = time.perf_counter()
+    for _ in range(workers):
+        math.factorial(n)
+    serial = time.perf_counter() - start
+
+    start = time.perf_counter()
+    loop.run_until_complete(run_all(n))
+    parallel = time.perf_counter() - start
+
+    assert parallel < serial
@@ -0,0 +1,36 @@
+import importlib
+import timeit
+import uuid
+
+import pytest
+
+
+@pytest.fixture
+def cls():
+    module = importlib.import_module("endstone.ban")
+    return getattr(module, "PlayerBanEntry")
+
+
+def test_uuid_round_trip(cls):
+    for value in [uuid.UUID(int=0), uuid.UUID(int=(1 << 128) - 1), uuid.uuid4(), uuid.uuid5(uuid.NAMESPACE_DNS, "a")]:
+        unique_id = cls("player", uuid=value).unique_id
+        assert isinstance(unique_id, uuid.UUID)
+        assert unique_id == value
+        assert str(unique_id) == str(value)
+        assert hash(unique_id) == hash(value)
+        assert unique_id.version == value.version
+
+
+def test_uuid_invalid_type(cls):
+    with pytest.raises(TypeError):
+        cls("player", uuid=str(uuid.uuid4()))
+
+
+def test_uuid_benchmark(cls):
+    value = uuid.uuid4()
+    entry = cls("player", uuid=value)
+
+    # The caster fills the uuid.UUID slots directly, so reading the property must beat building the UUID from bytes
+    to_python = min(timeit.repeat(lambda: entry.unique_id, number=10_000, repeat=5))
+    baseline = min(timeit.repeat(lambda: uuid.UUID(bytes=value.bytes), number=10_000, repeat=5))
+    assert to_python < baseline